@@ -20,6 +20,7 @@
 #pragma once
 
 #include "best_practices/bp_constants.h"
+#include "best_practices/bp_state.h"
 #include "chassis/validation_object.h"
 #include "state_tracker/shader_module.h"
 #include "state_tracker/state_tracker.h"
@@ -438,7 +439,7 @@ class BestPractices : public vvl::DeviceProxy {
     bool PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo,
                                          const ErrorObject& error_obj) const override;
 
-    using QueueCallback = std::function<bool(const class vvl::Queue& queue_state, const vvl::CommandBuffer& cb_state)>;
+    using QueueCallback = bp_state::CommandBufferSubState::QueueCallback;
     using QueueCallbacks = std::vector<QueueCallback>;
 
     void QueueValidateImageView(QueueCallbacks& func, const Location& loc, const vvl::ImageView& image_view,
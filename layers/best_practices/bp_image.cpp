@@ -173,11 +173,14 @@ void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const Location& lo
 
 void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const Location& loc, vvl::Image& image_state,
                                        IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t array_layer, uint32_t mip_level) {
-    funcs.emplace_back(
-        [this, loc, &image_state, usage, array_layer, mip_level](const vvl::Queue& qs, const vvl::CommandBuffer& cbs) -> bool {
-            ValidateImageInQueue(qs, cbs, loc, image_state, usage, array_layer, mip_level);
-            return false;
-        });
+    auto callback = [this, loc, &image_state, usage, array_layer, mip_level](const vvl::Queue& qs,
+                                                                             const vvl::CommandBuffer& cbs) -> bool {
+        ValidateImageInQueue(qs, cbs, loc, image_state, usage, array_layer, mip_level);
+        return false;
+    };
+    static_assert(sizeof(callback) <= bp_state::CommandBufferSubState::kQueueCallbackCapacity,
+                  "Capture doesn't fit in QueueCallback");
+    funcs.emplace_back(std::move(callback));
 }
 
 void BestPractices::ValidateImageInQueueArmImg(const Location& loc, vvl::Image& image_state, IMAGE_SUBRESOURCE_USAGE_BP last_usage,
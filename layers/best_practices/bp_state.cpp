@@ -674,15 +674,16 @@ void CommandBufferSubState::RecordBarriers(uint32_t, const VkBufferMemoryBarrier
         if (barrier.srcQueueFamilyIndex != barrier.dstQueueFamilyIndex &&
             barrier.dstQueueFamilyIndex == base.command_pool->queueFamilyIndex) {
             auto subresource_range = barrier.subresourceRange;
-            queue_submit_functions.emplace_back(
-                [image_state, subresource_range](const vvl::Queue& qs, const vvl::CommandBuffer& cbs) -> bool {
-                    ForEachSubresource(*image_state, subresource_range, [&](uint32_t layer, uint32_t level) {
-                        // Update queue family index without changing usage, signifying a correct queue family transfer
-                        auto& sub_state = bp_state::SubState(*image_state);
-                        sub_state.UpdateUsage(layer, level, sub_state.GetUsageType(layer, level), qs.queue_family_index);
-                    });
-                    return false;
+            auto callback = [image_state, subresource_range](const vvl::Queue& qs, const vvl::CommandBuffer& cbs) -> bool {
+                ForEachSubresource(*image_state, subresource_range, [&](uint32_t layer, uint32_t level) {
+                    // Update queue family index without changing usage, signifying a correct queue family transfer
+                    auto& sub_state = bp_state::SubState(*image_state);
+                    sub_state.UpdateUsage(layer, level, sub_state.GetUsageType(layer, level), qs.queue_family_index);
                 });
+                return false;
+            };
+            static_assert(sizeof(callback) <= kQueueCallbackCapacity, "Capture doesn't fit in QueueCallback");
+            queue_submit_functions.emplace_back(std::move(callback));
         }
 
         if (validator.VendorCheckEnabled(kBPVendorNVIDIA)) {
@@ -705,15 +706,16 @@ void CommandBufferSubState::RecordBarriers2(const VkDependencyInfo& dep_info, co
         if (barrier.srcQueueFamilyIndex != barrier.dstQueueFamilyIndex &&
             barrier.dstQueueFamilyIndex == base.command_pool->queueFamilyIndex) {
             auto subresource_range = barrier.subresourceRange;
-            queue_submit_functions.emplace_back(
-                [image_state, subresource_range](const vvl::Queue& qs, const vvl::CommandBuffer& cbs) -> bool {
-                    ForEachSubresource(*image_state, subresource_range, [&](uint32_t layer, uint32_t level) {
-                        // Update queue family index without changing usage, signifying a correct queue family transfer
-                        auto& sub_state = bp_state::SubState(*image_state);
-                        sub_state.UpdateUsage(layer, level, sub_state.GetUsageType(layer, level), qs.queue_family_index);
-                    });
-                    return false;
+            auto callback = [image_state, subresource_range](const vvl::Queue& qs, const vvl::CommandBuffer& cbs) -> bool {
+                ForEachSubresource(*image_state, subresource_range, [&](uint32_t layer, uint32_t level) {
+                    // Update queue family index without changing usage, signifying a correct queue family transfer
+                    auto& sub_state = bp_state::SubState(*image_state);
+                    sub_state.UpdateUsage(layer, level, sub_state.GetUsageType(layer, level), qs.queue_family_index);
                 });
+                return false;
+            };
+            static_assert(sizeof(callback) <= kQueueCallbackCapacity, "Capture doesn't fit in QueueCallback");
+            queue_submit_functions.emplace_back(std::move(callback));
         }
 
         if (validator.VendorCheckEnabled(kBPVendorNVIDIA)) {
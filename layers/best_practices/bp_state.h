@@ -27,6 +27,7 @@
 #include "state_tracker/image_state.h"
 #include "state_tracker/descriptor_sets.h"
 #include "state_tracker/push_constant_data.h"
+#include "external/inplace_function.h"
 
 class BestPractices;
 
@@ -246,7 +247,12 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
     };
     vvl::unordered_map<VkEvent, SignalingInfo> event_signaling_state;
 
-    using QueueCallback = std::function<bool(const class vvl::Queue& queue_state, const vvl::CommandBuffer& cb_state)>;
+    // One callback is recorded per image subresource used by copies, clears and render passes, so keep the captures in
+    // place instead of heap allocating each closure (sized for the QueueValidateImage() lambda).
+    // Each capture site static_asserts that it fits.
+    static constexpr size_t kQueueCallbackCapacity = 96;
+    using QueueCallback = stdext::inplace_function<bool(const class vvl::Queue& queue_state, const vvl::CommandBuffer& cb_state),
+                                                   kQueueCallbackCapacity>;
     std::vector<QueueCallback> queue_submit_functions;
     // Used by some layers to defer actions until vkCmdEndRenderPass time.
     // Layers using this are responsible for inserting the callbacks into queue_submit_functions.
@@ -0,0 +1,189 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace vvl {
+
+// Memory pool for the nodes of a single node based container (std::map, std::set, std::list).
+// Blocks are carved out of chunks owned by the pool and recycled through per block size free lists, so nodes of one
+// container sit next to each other and are not individually returned to the system heap. The memory is released when
+// the pool is destroyed, so only long-lived containers that churn their nodes should use a pool.
+// Not thread safe, a pool belongs to one container which has the usual container threading rules.
+class node_pool {
+  public:
+    node_pool() = default;
+    node_pool(const node_pool &) = delete;
+    node_pool &operator=(const node_pool &) = delete;
+
+    void *allocate(size_t size) {
+        if (size > kMaxBlockSize) {
+            return ::operator new(size);
+        }
+        const size_t block_size = BlockSize(size);
+        FreeList &free_list = GetFreeList(block_size);
+        if (FreeBlock *block = free_list.head) {
+            free_list.head = block->next;
+            return block;
+        }
+        if (chunk_remaining_ < block_size) {
+            NewChunk(block_size);
+        }
+        void *block = chunk_cursor_;
+        chunk_cursor_ += block_size;
+        chunk_remaining_ -= block_size;
+        return block;
+    }
+
+    // Memory held by the pool chunks, whether the blocks are in use or not
+    size_t ChunkMemory() const { return chunk_memory_; }
+
+    void deallocate(void *ptr, size_t size) {
+        if (size > kMaxBlockSize) {
+            ::operator delete(ptr);
+            return;
+        }
+        FreeList &free_list = GetFreeList(BlockSize(size));
+        auto *block = static_cast<FreeBlock *>(ptr);
+        block->next = free_list.head;
+        free_list.head = block;
+    }
+
+  private:
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+    // A map allocates a single node size (plus its sentinel on some implementations), so a short list searched
+    // linearly is enough and keeps an empty pool small
+    struct FreeList {
+        size_t block_size;
+        FreeBlock *head;
+    };
+    static constexpr size_t kGranularity = alignof(std::max_align_t);
+    static constexpr size_t kMaxBlockSize = 2048;
+    static constexpr size_t kMinChunkSize = 1024;
+    static constexpr size_t kMaxChunkSize = 64 * 1024;
+    static_assert(sizeof(FreeBlock) <= kGranularity);
+
+    static size_t BlockSize(size_t size) { return std::max<size_t>(1, (size + kGranularity - 1) / kGranularity) * kGranularity; }
+
+    FreeList &GetFreeList(size_t block_size) {
+        for (FreeList &free_list : free_lists_) {
+            if (free_list.block_size == block_size) {
+                return free_list;
+            }
+        }
+        free_lists_.emplace_back(FreeList{block_size, nullptr});
+        return free_lists_.back();
+    }
+
+    void NewChunk(size_t min_size) {
+        // Chunks grow geometrically so small containers stay small and large ones amortize to few chunks
+        next_chunk_size_ = std::max(next_chunk_size_, min_size);
+        const size_t element_count = next_chunk_size_ / sizeof(std::max_align_t);
+        chunks_.emplace_back(new std::max_align_t[element_count]);
+        chunk_cursor_ = reinterpret_cast<std::byte *>(chunks_.back().get());
+        chunk_remaining_ = element_count * sizeof(std::max_align_t);
+        chunk_memory_ += chunk_remaining_;
+        next_chunk_size_ = std::min(next_chunk_size_ * 2, kMaxChunkSize);
+    }
+
+    std::vector<FreeList> free_lists_;
+    std::vector<std::unique_ptr<std::max_align_t[]>> chunks_;
+    std::byte *chunk_cursor_ = nullptr;
+    size_t chunk_remaining_ = 0;
+    size_t chunk_memory_ = 0;
+    size_t next_chunk_size_ = kMinChunkSize;
+};
+
+// Allocator that can give a container its own node_pool.
+// A default constructed allocator has no pool and goes straight to the system heap like std::allocator, so temporary
+// containers pay nothing for it. Long-lived containers opt in with WithPool().
+// Copies of the allocator (including the rebound copies the container makes for its node type) share the pool, while a
+// copied container gets a fresh pool.
+template <typename T>
+class node_pool_allocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+
+    node_pool_allocator() noexcept = default;
+    static node_pool_allocator WithPool() { return node_pool_allocator(std::make_shared<node_pool>()); }
+
+    node_pool_allocator(const node_pool_allocator &other) noexcept = default;
+    node_pool_allocator &operator=(const node_pool_allocator &other) noexcept = default;
+    // A moved allocator must keep comparing equal to its source: containers may move it into the new container and keep
+    // freeing the source's nodes with the source's copy (MSVC's map allocates the new sentinel with the moved allocator
+    // and swaps it into the source). So a move keeps the source on the pool, and range_map detaches its moved-from map
+    // from it instead.
+    node_pool_allocator(node_pool_allocator &&other) noexcept : pool_(other.pool_) {}
+    node_pool_allocator &operator=(node_pool_allocator &&other) noexcept {
+        pool_ = other.pool_;
+        return *this;
+    }
+    template <typename U>
+    node_pool_allocator(const node_pool_allocator<U> &other) noexcept : pool_(other.pool_) {}
+
+    T *allocate(size_t n) {
+        return static_cast<T *>(pool_ ? pool_->allocate(n * sizeof(T)) : ::operator new(n * sizeof(T)));
+    }
+    void deallocate(T *ptr, size_t n) noexcept {
+        if (pool_) {
+            pool_->deallocate(ptr, n * sizeof(T));
+        } else {
+            ::operator delete(ptr);
+        }
+    }
+
+    node_pool_allocator select_on_container_copy_construction() const {
+        return pool_ ? WithPool() : node_pool_allocator();
+    }
+
+    bool HasPool() const { return pool_ != nullptr; }
+    size_t PoolMemory() const { return pool_ ? pool_->ChunkMemory() : 0; }
+
+    template <typename U>
+    bool operator==(const node_pool_allocator<U> &rhs) const noexcept {
+        return pool_ == rhs.pool_;
+    }
+    template <typename U>
+    bool operator!=(const node_pool_allocator<U> &rhs) const noexcept {
+        return pool_ != rhs.pool_;
+    }
+
+  private:
+    template <typename U>
+    friend class node_pool_allocator;
+
+    explicit node_pool_allocator(std::shared_ptr<node_pool> pool) noexcept : pool_(std::move(pool)) {}
+
+    std::shared_ptr<node_pool> pool_;
+};
+
+}  // namespace vvl
@@ -24,7 +24,9 @@
 #include <cassert>
 #include <limits>
 #include <map>
+#include <memory>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <cstdint>
 #include "containers/range.h"
@@ -84,8 +86,32 @@ class range_map {
     using key_type = typename ImplMap::key_type;
     using index_type = typename key_type::index_type;
     using size_type = typename ImplMap::size_type;
+    using allocator_type = typename ImplMap::allocator_type;
+
+    range_map() = default;
+    explicit range_map(const allocator_type &allocator) : impl_map_(allocator) {}
+    range_map(const range_map &other) = default;
+    range_map &operator=(const range_map &other) = default;
+    // A moved allocator keeps sharing its state with the source (see vvl::node_pool_allocator), so a moved-from map with
+    // a stateful allocator is handed a default one to keep it from using the new owner's allocator
+    range_map(range_map &&other) noexcept(kNothrowMove) : impl_map_(std::move(other.impl_map_)) { other.DetachAllocator(); }
+    range_map &operator=(range_map &&other) noexcept(kNothrowMove) {
+        impl_map_ = std::move(other.impl_map_);
+        other.DetachAllocator();
+        return *this;
+    }
+    allocator_type get_allocator() const { return impl_map_.get_allocator(); }
 
   protected:
+    static constexpr bool kNothrowMove = std::is_nothrow_move_constructible_v<ImplMap> &&
+                                         std::is_nothrow_move_assignable_v<ImplMap> &&
+                                         std::allocator_traits<allocator_type>::is_always_equal::value;
+    void DetachAllocator() {
+        if constexpr (!std::allocator_traits<allocator_type>::is_always_equal::value) {
+            impl_map_ = ImplMap();
+        }
+    }
+
     template <typename ThisType>
     using ConstCorrectImplIterator = decltype(std::declval<ThisType>().impl_begin());
 
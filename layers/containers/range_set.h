@@ -0,0 +1,108 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "containers/range.h"
+
+namespace vvl {
+
+// Set of indices stored as sorted, disjoint ranges. Overlapping and adjacent ranges are coalesced on insert, so marking
+// N consecutive indices is a single entry and membership is a binary search over the ranges.
+template <typename Index>
+class range_set {
+  public:
+    using index_type = Index;
+    using range_type = vvl::range<Index>;
+    using container_type = std::vector<range_type>;
+    using const_iterator = typename container_type::const_iterator;
+
+    void insert(const range_type &range) {
+        if (!range.non_empty()) {
+            return;
+        }
+        // First range that overlaps or touches the new one, and the first one past it
+        auto first = std::lower_bound(ranges_.begin(), ranges_.end(), range.begin,
+                                      [](const range_type &entry, const index_type &index) { return entry.end < index; });
+        auto last = std::upper_bound(first, ranges_.end(), range.end,
+                                     [](const index_type &index, const range_type &entry) { return index < entry.begin; });
+        if (first == last) {
+            ranges_.insert(first, range);
+            return;
+        }
+        first->begin = std::min(first->begin, range.begin);
+        first->end = std::max(std::prev(last)->end, range.end);
+        ranges_.erase(std::next(first), last);
+    }
+    void insert(const index_type &index) { insert(range_type(index, index + 1)); }
+    // Merges in all the ranges of another set in a single pass, instead of shifting the storage once per range
+    void insert(const range_set &other) {
+        if (other.empty()) {
+            return;
+        }
+        container_type merged;
+        merged.reserve(ranges_.size() + other.ranges_.size());
+        auto append = [&merged](const range_type &range) {
+            if (!merged.empty() && range.begin <= merged.back().end) {
+                merged.back().end = std::max(merged.back().end, range.end);
+            } else {
+                merged.emplace_back(range);
+            }
+        };
+        auto it = ranges_.begin();
+        auto other_it = other.ranges_.begin();
+        while (it != ranges_.end() || other_it != other.ranges_.end()) {
+            if (other_it == other.ranges_.end() || (it != ranges_.end() && it->begin < other_it->begin)) {
+                append(*it++);
+            } else {
+                append(*other_it++);
+            }
+        }
+        ranges_ = std::move(merged);
+    }
+
+    bool contains(const index_type &index) const {
+        auto it = std::upper_bound(ranges_.begin(), ranges_.end(), index,
+                                   [](const index_type &value, const range_type &entry) { return value < entry.begin; });
+        return it != ranges_.begin() && std::prev(it)->includes(index);
+    }
+
+    bool intersects(const range_type &range) const {
+        if (!range.non_empty()) {
+            return false;
+        }
+        // First stored range ending past the start of the query is the only candidate
+        auto it = std::upper_bound(ranges_.begin(), ranges_.end(), range.begin,
+                                   [](const index_type &index, const range_type &entry) { return index < entry.end; });
+        return it != ranges_.end() && it->begin < range.end;
+    }
+
+    void clear() { ranges_.clear(); }
+    bool empty() const { return ranges_.empty(); }
+    // Number of disjoint ranges, not the number of indices
+    size_t size() const { return ranges_.size(); }
+    const_iterator begin() const { return ranges_.begin(); }
+    const_iterator end() const { return ranges_.end(); }
+
+  private:
+    container_type ranges_;
+};
+
+}  // namespace vvl
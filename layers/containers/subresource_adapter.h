@@ -668,11 +668,20 @@ class BothRangeMap {
 
     BothRangeMap() = delete;
 
-    BothRangeMap(index_type limit) {
+    // Construct the selected map in place: with larger N the SmallMap carries N-entry arrays, so default constructing the
+    // variant's first alternative and then move assigning a second one would initialize and copy them twice.
+    BothRangeMap(index_type limit) : map_(std::in_place_type<BigMap>) {
         if (limit <= N) {
-            map_ = SmallMap(limit);
+            map_.template emplace<SmallMap>(limit);
+        }
+    }
+
+    // Keeps the SmallMap storage, so a cleared map can be reused for another resource with the same limit
+    void clear() {
+        if (UsesSmallMap()) {
+            GetSmallMap().clear();
         } else {
-            map_ = BigMap();
+            GetBigMap().clear();
         }
     }
 
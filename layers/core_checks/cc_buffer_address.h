@@ -85,7 +85,7 @@ class BufferAddressValidation {
         if (device_address == 0) {
             return skip;
         }
-        vvl::span<vvl::Buffer* const> buffer_list = validator.GetBuffersByAddress(device_address);
+        const auto buffer_list = validator.GetBuffersByAddress(device_address);
         if (buffer_list.empty()) {
             skip |= validator.LogError(
                 "VUID-VkDeviceAddress-size-11364", objlist, device_address_loc,
@@ -259,13 +259,22 @@ bool CoreChecks::ValidateCmdBufImageLayouts(
 
         // Validate the initial_uses for each subresource referenced
         const auto subresource_count = image_state->subresource_encoder.SubresourceCount();
-        auto it = local_image_layout_state.try_emplace(image_state.get(), subresource_count).first;
+        auto [it, first_use_in_submission] = local_image_layout_state.try_emplace(image_state.get(), subresource_count);
         ImageLayoutMap &local_layout_map = it->second;
 
         const auto *global_layout_map = image_state->layout_map.get();
         ASSERT_AND_CONTINUE(global_layout_map);
         auto global_layout_map_guard = image_state->LayoutMapReadLock();
 
+        // When no earlier command buffer of this submission touched the image, the result only depends on the global
+        // layouts. If they are unchanged since the last time this command buffer was found valid, there is nothing to check.
+        const uint64_t global_layout_version = image_state->LayoutMapVersion();
+        if (first_use_in_submission && cb_layout_map->validated_layout_version.load() == global_layout_version) {
+            sparse_container::splice(local_layout_map, *cb_layout_map, GlobalLayoutUpdater());
+            continue;
+        }
+        bool found_mismatch = false;
+
         auto pos = cb_layout_map->begin();
         const auto end = cb_layout_map->end();
         sparse_container::parallel_iterator<const ImageLayoutMap> current_layout(local_layout_map, *global_layout_map,
@@ -291,6 +300,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(
                 const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
                 const bool matches = ImageLayoutMatches(aspect_mask, image_layout, first_layout);
                 if (!matches) {
+                    found_mismatch = true;
                     // We can report all the errors for the intersected range directly
                     for (auto index : vvl::range_view<decltype(intersected_range)>(intersected_range)) {
                         const auto subresource = image_state->subresource_encoder.Decode(index);
@@ -315,6 +325,10 @@ bool CoreChecks::ValidateCmdBufImageLayouts(
                 }
             }
         }
+        // Validation against a local overlay says nothing about the global layouts alone, so only cache the plain case
+        const bool cacheable = first_use_in_submission && !found_mismatch;
+        cb_layout_map->validated_layout_version.store(cacheable ? global_layout_version : 0);
+
         // Update all layout set operations (which will be a subset of the initial_layouts)
         sparse_container::splice(local_layout_map, *cb_layout_map, GlobalLayoutUpdater());
     }
@@ -322,12 +336,49 @@ bool CoreChecks::ValidateCmdBufImageLayouts(
     return skip;
 }
 
+// Returns true if, once the command buffer layouts are applied to the global layouts, the first layouts of the
+// command buffer are satisfied again. Subresources that are not transitioned keep their (already validated) layout.
+static bool CmdBufImageLayoutsRoundTrip(const vvl::Image &image_state, const CommandBufferImageLayoutMap &cb_layout_map) {
+    for (const auto &[range, state] : cb_layout_map) {
+        if (state.first_layout == kInvalidLayout || state.first_layout == VK_IMAGE_LAYOUT_UNDEFINED ||
+            state.current_layout == kInvalidLayout || state.current_layout == state.first_layout) {
+            continue;
+        }
+        const auto aspect_mask = image_state.subresource_encoder.Decode(range.begin).aspectMask;
+        if (!ImageLayoutMatches(aspect_mask, state.current_layout, state.first_layout)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void CoreChecks::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_state) {
     for (const auto &[image, cb_layout_map] : cb_state.image_layout_registry) {
         const auto image_state = Get<vvl::Image>(image);
         if (image_state && cb_layout_map && image_state->GetId() == cb_layout_map->image_id) {
             auto guard = image_state->LayoutMapWriteLock();
+            // Still valid if nothing wrote the global layouts between validation and this update
+            const uint64_t validated_version = cb_layout_map->validated_layout_version.load();
+            const bool validated_current = validated_version != 0 && validated_version == image_state->LayoutMapVersion();
+
             sparse_container::splice(*image_state->layout_map, *cb_layout_map, GlobalLayoutUpdater());
+            image_state->BumpLayoutMapVersion();
+
+            // Carry the validation result over our own update, so a command buffer that leaves its images in the layouts
+            // it expects at the start can be resubmitted without walking the global layout map again.
+            if (validated_current) {
+                using RoundTrip = CommandBufferImageLayoutMap::RoundTrip;
+                RoundTrip round_trip = cb_layout_map->layouts_round_trip.load();
+                if (round_trip == RoundTrip::kUnknown) {
+                    round_trip = CmdBufImageLayoutsRoundTrip(*image_state, *cb_layout_map) ? RoundTrip::kYes : RoundTrip::kNo;
+                    cb_layout_map->layouts_round_trip.store(round_trip);
+                }
+                if (round_trip == RoundTrip::kYes) {
+                    cb_layout_map->validated_layout_version.store(image_state->LayoutMapVersion());
+                    continue;
+                }
+            }
+            cb_layout_map->validated_layout_version.store(0);
         }
     }
 }
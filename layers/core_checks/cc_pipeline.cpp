@@ -44,6 +44,31 @@ bool CoreChecks::IsBeforeCtsVersion(uint32_t major, uint32_t minor, uint32_t sub
     return phys_dev_props_core12.conformanceVersion.subminor < subminor;
 }
 
+bool CoreChecks::ValidatePipelineBatch(uint32_t count, const std::function<bool(uint32_t)> &validate) const {
+    bool skip = false;
+    if (count < vvl::DeviceState::kParallelPipelineBatchThreshold) {
+        for (uint32_t i = 0; i < count; i++) {
+            skip |= validate(i);
+        }
+        return skip;
+    }
+
+    // Each pipeline keeps its own messages so the output doesn't depend on which thread got to it first.
+    // The workers assume the callbacks return what they did last time, so an application whose callbacks always return the same
+    // value gets the messages the serial path would have reported. Whatever they return, each message is reported once.
+    const bool callback_result = debug_report->LastCallbackResult();
+    std::vector<std::vector<vvl::DeferredLogMessage>> messages(count);
+    device_state->worker_pool_.ParallelFor(count, [&](uint32_t i) {
+        vvl::ScopedLogDeferral deferral(messages[i], callback_result);
+        validate(i);
+    });
+    // Only the callbacks decide whether the call is skipped
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= debug_report->LogDeferredMessages(messages[i]);
+    }
+    return skip;
+}
+
 bool CoreChecks::ValidatePipelineCacheControlFlags(VkPipelineCreateFlags2 flags, const Location &flags_loc,
                                                    const char *vuid) const {
     bool skip = false;
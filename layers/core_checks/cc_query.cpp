@@ -48,14 +48,8 @@ bool CoreChecks::PreCallValidateDestroyQueryPool(VkDevice device, VkQueryPool qu
     const auto query_pool_state = Get<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
 
-    bool completed_by_get_results = true;
-    for (uint32_t i = 0; i < query_pool_state->create_info.queryCount; ++i) {
-        auto state = query_pool_state->GetQueryState(i, 0);
-        if (state != QUERYSTATE_AVAILABLE) {
-            completed_by_get_results = false;
-            break;
-        }
-    }
+    const bool completed_by_get_results =
+        query_pool_state->HasQueryStates(0, query_pool_state->create_info.queryCount, 0, QUERYSTATE_AVAILABLE);
     if (!completed_by_get_results) {
         skip |= ValidateObjectNotInUse(query_pool_state.get(), error_obj.location, "VUID-vkDestroyQueryPool-queryPool-00793");
     }
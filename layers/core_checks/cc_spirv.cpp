@@ -1777,8 +1777,8 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
         std::stringstream err;
         err << "\"" << stage_state.GetPName() << "\" entry point not found for stage " << string_VkShaderStageFlagBits(stage)
             << ".";
-        if (stage_state.spirv_state->static_data_.entry_points.size() == 1) {
-            auto entry_point = stage_state.spirv_state->static_data_.entry_points[0];
+        if (stage_state.spirv_state->GetEntryPoints().size() == 1) {
+            auto entry_point = stage_state.spirv_state->GetEntryPoints()[0];
             if (entry_point) {
                 err << " (The only entry point found was \"" << entry_point->name << "\" for "
                     << string_VkShaderStageFlagBits(entry_point->stage) << ")";
@@ -1790,7 +1790,7 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
             }
         } else {
             err << " The following entry points were found in the SPIR-V module:\n";
-            for (const auto &entry_point : stage_state.spirv_state->static_data_.entry_points) {
+            for (const auto &entry_point : stage_state.spirv_state->GetEntryPoints()) {
                 if (!entry_point) continue;
                 err << "\"" << entry_point->name << "\"\t(" << string_VkShaderStageFlagBits(entry_point->stage) << ")\n";
             }
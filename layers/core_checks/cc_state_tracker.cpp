@@ -295,8 +295,8 @@ void CommandBufferSubState::RecordCopyBufferCommon(vvl::Buffer& src_buffer_state
         }
         return skip;
     };
-
-    queue_submit_functions.emplace_back(queue_submit_validation);
+    static_assert(sizeof(queue_submit_validation) <= kQueueCallbackCapacity, "Capture doesn't fit in QueueCallback");
+    queue_submit_functions.emplace_back(std::move(queue_submit_validation));
 }
 
 void CommandBufferSubState::RecordCopyBuffer(vvl::Buffer& src_buffer_state, vvl::Buffer& dst_buffer_state, uint32_t region_count,
@@ -501,20 +501,22 @@ void CommandBufferSubState::RecordSetEvent(VkEvent event, VkPipelineStageFlags2
         // Set sType to invalid, so following code can check sType to see if the struct is valid
         safe_dependency_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
     }
-    event_updates.emplace_back([event, stage_mask, safe_dependency_info](vvl::CommandBuffer&, bool do_validate,
-                                                                         EventMap& local_event_signal_info, VkQueue,
-                                                                         const Location& loc) {
+    auto update = [event, stage_mask, safe_dependency_info](vvl::CommandBuffer&, bool do_validate,
+                                                            EventMap& local_event_signal_info, VkQueue, const Location& loc) {
         local_event_signal_info[event] = EventInfo{stage_mask, true, safe_dependency_info};
         return false;  // skip
-    });
+    };
+    static_assert(sizeof(update) <= kEventCallbackCapacity, "Capture doesn't fit in EventCallback");
+    event_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordResetEvent(VkEvent event, VkPipelineStageFlags2) {
-    event_updates.emplace_back(
-        [event](vvl::CommandBuffer&, bool do_validate, EventMap& local_event_signal_info, VkQueue, const Location& loc) {
-            local_event_signal_info[event] = EventInfo{VK_PIPELINE_STAGE_2_NONE, false};
-            return false;  // skip
-        });
+    auto update = [event](vvl::CommandBuffer&, bool do_validate, EventMap& local_event_signal_info, VkQueue, const Location& loc) {
+        local_event_signal_info[event] = EventInfo{VK_PIPELINE_STAGE_2_NONE, false};
+        return false;  // skip
+    };
+    static_assert(sizeof(update) <= kEventCallbackCapacity, "Capture doesn't fit in EventCallback");
+    event_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordWaitEvents(uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags2 src_stage_mask,
@@ -531,13 +533,15 @@ void CommandBufferSubState::RecordWaitEvents(uint32_t eventCount, const VkEvent*
         safe_dependency_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
     }
 
-    event_updates.emplace_back(
-        [event_added_count, first_event_index, src_stage_mask, safe_dependency_info](
-            vvl::CommandBuffer& cb_state, bool do_validate, EventMap& local_event_signal_info, VkQueue queue, const Location& loc) {
-            if (!do_validate) return false;
-            return CoreChecks::ValidateWaitEventsAtSubmit(cb_state, event_added_count, first_event_index, src_stage_mask,
-                                                          safe_dependency_info, local_event_signal_info, queue, loc);
-        });
+    auto update = [event_added_count, first_event_index, src_stage_mask, safe_dependency_info](
+                      vvl::CommandBuffer& cb_state, bool do_validate, EventMap& local_event_signal_info, VkQueue queue,
+                      const Location& loc) {
+        if (!do_validate) return false;
+        return CoreChecks::ValidateWaitEventsAtSubmit(cb_state, event_added_count, first_event_index, src_stage_mask,
+                                                      safe_dependency_info, local_event_signal_info, queue, loc);
+    };
+    static_assert(sizeof(update) <= kEventCallbackCapacity, "Capture doesn't fit in EventCallback");
+    event_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordBarriers(uint32_t buffer_barrier_count, const VkBufferMemoryBarrier* buffer_barriers,
@@ -598,9 +602,8 @@ static void SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint3
 }
 
 void CommandBufferSubState::RecordBeginQuery(const QueryObject& query_obj, const Location& loc) {
-    query_updates.emplace_back([this, query_obj, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate,
-                                                      VkQueryPool& first_perf_query_pool, uint32_t perf_query_pass,
-                                                      QueryMap* local_query_to_state_map) {
+    auto update = [this, query_obj, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool& first_perf_query_pool,
+                                         uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
         bool skip = false;
         // Need to enqueue validation before we update
         if (do_validate) {
@@ -611,12 +614,14 @@ void CommandBufferSubState::RecordBeginQuery(const QueryObject& query_obj, const
 
         SetQueryState(QueryObject(query_obj, perf_query_pass), QUERYSTATE_RUNNING, local_query_to_state_map);
         return skip;
-    });
+    };
+    static_assert(sizeof(update) <= kQueryCallbackCapacity, "Capture doesn't fit in QueryCallback");
+    query_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordEndQuery(const QueryObject& query_obj, const Location& loc) {
-    query_updates.emplace_back([this, query_obj, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
-                                                      uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
+    auto update = [this, query_obj, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
+                                         uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
         bool skip = false;
         if (do_validate) {
             auto query_pool_state = base.dev_data.Get<vvl::QueryPool>(query_obj.pool);
@@ -634,27 +639,33 @@ void CommandBufferSubState::RecordEndQuery(const QueryObject& query_obj, const L
 
         SetQueryState(QueryObject(query_obj, perf_query_pass), QUERYSTATE_ENDED, local_query_to_state_map);
         return skip;
-    });
+    };
+    static_assert(sizeof(update) <= kQueryCallbackCapacity, "Capture doesn't fit in QueryCallback");
+    query_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordWriteTimestamp(const QueryObject& query_obj, const Location& loc) {
-    query_updates.emplace_back([this, query_obj, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
-                                                      uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
+    auto update = [this, query_obj, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
+                                         uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
         bool skip = false;
         if (do_validate) {
             skip |= validator.VerifyQueryIsReset(cb_state_arg, query_obj, loc, perf_query_pass, local_query_to_state_map);
         }
         SetQueryState(QueryObject(query_obj, perf_query_pass), QUERYSTATE_ENDED, local_query_to_state_map);
         return skip;
-    });
+    };
+    static_assert(sizeof(update) <= kQueryCallbackCapacity, "Capture doesn't fit in QueryCallback");
+    query_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordEndQueries(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
-    query_updates.emplace_back([queryPool, firstQuery, queryCount](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
-                                                                   uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
+    auto update = [queryPool, firstQuery, queryCount](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
+                                                      uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
         SetQueryStateMulti(queryPool, firstQuery, queryCount, perf_query_pass, QUERYSTATE_ENDED, local_query_to_state_map);
         return false;
-    });
+    };
+    static_assert(sizeof(update) <= kQueryCallbackCapacity, "Capture doesn't fit in QueryCallback");
+    query_updates.emplace_back(std::move(update));
 }
 
 static QueryState GetLocalQueryState(const QueryMap* local_query_to_state_map, VkQueryPool queryPool, uint32_t queryIndex,
@@ -669,63 +680,67 @@ static QueryState GetLocalQueryState(const QueryMap* local_query_to_state_map, V
 
 void CommandBufferSubState::RecordResetQueryPool(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
                                                  bool is_perf_query, const Location& loc) {
-    query_updates.emplace_back(
-        [queryPool, firstQuery, queryCount, is_perf_query, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
-                                                                uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
-            bool skip = false;
-            if (is_perf_query && do_validate) {
-                const auto& state_data = cb_state_arg.dev_data;
-                for (uint32_t i = 0; i < queryCount; i++) {
-                    QueryState state = GetLocalQueryState(local_query_to_state_map, queryPool, firstQuery + i, perf_query_pass);
-                    if (state == QUERYSTATE_ENDED) {
-                        const LogObjectList objlist(cb_state_arg.Handle(), queryPool);
-                        skip |= state_data.LogError("VUID-vkCmdResetQueryPool-firstQuery-02862", objlist, loc,
-                                                    "Query index %" PRIu32 " was begun and reset in the same command buffer.",
-                                                    firstQuery + i);
-                        break;
-                    }
+    auto update = [queryPool, firstQuery, queryCount, is_perf_query, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate,
+                                                                          VkQueryPool&, uint32_t perf_query_pass,
+                                                                          QueryMap* local_query_to_state_map) {
+        bool skip = false;
+        if (is_perf_query && do_validate) {
+            const auto& state_data = cb_state_arg.dev_data;
+            for (uint32_t i = 0; i < queryCount; i++) {
+                QueryState state = GetLocalQueryState(local_query_to_state_map, queryPool, firstQuery + i, perf_query_pass);
+                if (state == QUERYSTATE_ENDED) {
+                    const LogObjectList objlist(cb_state_arg.Handle(), queryPool);
+                    skip |= state_data.LogError("VUID-vkCmdResetQueryPool-firstQuery-02862", objlist, loc,
+                                                "Query index %" PRIu32 " was begun and reset in the same command buffer.",
+                                                firstQuery + i);
+                    break;
                 }
             }
-            SetQueryStateMulti(queryPool, firstQuery, queryCount, perf_query_pass, QUERYSTATE_RESET, local_query_to_state_map);
-            return skip;
-        });
+        }
+        SetQueryStateMulti(queryPool, firstQuery, queryCount, perf_query_pass, QUERYSTATE_RESET, local_query_to_state_map);
+        return skip;
+    };
+    static_assert(sizeof(update) <= kQueryCallbackCapacity, "Capture doesn't fit in QueryCallback");
+    query_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordCopyQueryPoolResults(vvl::QueryPool& pool_state, vvl::Buffer&, uint32_t first_query,
                                                        uint32_t query_count, VkDeviceSize, VkDeviceSize, VkQueryResultFlags flags,
                                                        const Location& loc) {
-    query_updates.emplace_back(
-        [this, &pool_state, first_query, query_count, flags, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
-                                                                  uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
-            if (!do_validate) {
-                return false;
-            }
-            bool skip = false;
-            for (uint32_t i = 0; i < query_count; i++) {
-                QueryState state =
-                    GetLocalQueryState(local_query_to_state_map, pool_state.VkHandle(), first_query + i, perf_query_pass);
-                QueryResultType result_type = pool_state.GetQueryResultType(state, flags);
-                if (result_type != QUERYRESULT_SOME_DATA && result_type != QUERYRESULT_UNKNOWN) {
-                    const LogObjectList objlist(cb_state_arg.Handle(), pool_state.Handle());
-                    skip |= validator.LogError("VUID-vkCmdCopyQueryPoolResults-None-08752", objlist, loc,
-                                               "Requesting a copy from query to buffer on %s query %" PRIu32 ": %s",
-                                               validator.FormatHandle(pool_state.Handle()).c_str(), first_query + i,
-                                               string_QueryResultType(result_type));
-                }
+    auto update = [this, &pool_state, first_query, query_count, flags, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate,
+                                                                            VkQueryPool&, uint32_t perf_query_pass,
+                                                                            QueryMap* local_query_to_state_map) {
+        if (!do_validate) {
+            return false;
+        }
+        bool skip = false;
+        for (uint32_t i = 0; i < query_count; i++) {
+            QueryState state =
+                GetLocalQueryState(local_query_to_state_map, pool_state.VkHandle(), first_query + i, perf_query_pass);
+            QueryResultType result_type = pool_state.GetQueryResultType(state, flags);
+            if (result_type != QUERYRESULT_SOME_DATA && result_type != QUERYRESULT_UNKNOWN) {
+                const LogObjectList objlist(cb_state_arg.Handle(), pool_state.Handle());
+                skip |= validator.LogError("VUID-vkCmdCopyQueryPoolResults-None-08752", objlist, loc,
+                                           "Requesting a copy from query to buffer on %s query %" PRIu32 ": %s",
+                                           validator.FormatHandle(pool_state.Handle()).c_str(), first_query + i,
+                                           string_QueryResultType(result_type));
             }
+        }
 
-            skip |= validator.ValidateQueryPoolWasReset(pool_state, first_query, query_count, loc, local_query_to_state_map,
-                                                        perf_query_pass);
+        skip |= validator.ValidateQueryPoolWasReset(pool_state, first_query, query_count, loc, local_query_to_state_map,
+                                                    perf_query_pass);
 
-            return skip;
-        });
+        return skip;
+    };
+    static_assert(sizeof(update) <= kQueryCallbackCapacity, "Capture doesn't fit in QueryCallback");
+    query_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordWriteAccelerationStructuresProperties(VkQueryPool queryPool, uint32_t firstQuery,
                                                                         uint32_t accelerationStructureCount, const Location& loc) {
-    query_updates.emplace_back([this, accelerationStructureCount, firstQuery, queryPool, loc](
-                                   vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&, uint32_t perf_query_pass,
-                                   QueryMap* local_query_to_state_map) {
+    auto update = [this, accelerationStructureCount, firstQuery, queryPool, loc](vvl::CommandBuffer& cb_state_arg, bool do_validate,
+                                                                                 VkQueryPool&, uint32_t perf_query_pass,
+                                                                                 QueryMap* local_query_to_state_map) {
         bool skip = false;
         if (do_validate) {
             for (uint32_t i = 0; i < accelerationStructureCount; i++) {
@@ -736,17 +751,21 @@ void CommandBufferSubState::RecordWriteAccelerationStructuresProperties(VkQueryP
         SetQueryStateMulti(queryPool, firstQuery, accelerationStructureCount, perf_query_pass, QUERYSTATE_ENDED,
                            local_query_to_state_map);
         return skip;
-    });
+    };
+    static_assert(sizeof(update) <= kQueryCallbackCapacity, "Capture doesn't fit in QueryCallback");
+    query_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordVideoInlineQueries(const VkVideoInlineQueryInfoKHR& query_info) {
-    query_updates.emplace_back([query_info](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
-                                            uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
+    auto update = [query_info](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
+                               uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
         for (uint32_t i = 0; i < query_info.queryCount; i++) {
             SetQueryState(QueryObject(query_info.queryPool, query_info.firstQuery + i), QUERYSTATE_ENDED, local_query_to_state_map);
         }
         return false;
-    });
+    };
+    static_assert(sizeof(update) <= kQueryCallbackCapacity, "Capture doesn't fit in QueryCallback");
+    query_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordBeginVideoCoding(vvl::VideoSession& vs_state, const VkVideoBeginCodingInfoKHR& begin_info,
@@ -816,8 +835,8 @@ void CommandBufferSubState::EnqueueVerifyVideoSessionInitialized(vvl::VideoSessi
 void CommandBufferSubState::EnqueueVerifyVideoInlineQueryUnavailable(const VkVideoInlineQueryInfoKHR& query_info,
                                                                      vvl::Func command) {
     if (validator.disabled[query_validation]) return;
-    query_updates.emplace_back([this, query_info, command](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
-                                                           uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
+    auto update = [this, query_info, command](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool&,
+                                              uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
         if (!do_validate) return false;
         bool skip = false;
         for (uint32_t i = 0; i < query_info.queryCount; i++) {
@@ -825,7 +844,9 @@ void CommandBufferSubState::EnqueueVerifyVideoInlineQueryUnavailable(const VkVid
             skip |= validator.VerifyQueryIsReset(cb_state_arg, query_obj, command, perf_query_pass, local_query_to_state_map);
         }
         return skip;
-    });
+    };
+    static_assert(sizeof(update) <= kQueryCallbackCapacity, "Capture doesn't fit in QueryCallback");
+    query_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::RecordControlVideoCoding(vvl::VideoSession& vs_state, const VkVideoCodingControlInfoKHR& control_info,
@@ -1001,9 +1022,8 @@ void CommandBufferSubState::RecordExecuteCommand(vvl::CommandBuffer& secondary_c
     // This avoids locking ambiguity because primary command buffers are locked when these
     // callbacks run, but secondary command buffers are not.
     const VkCommandBuffer sub_command_buffer = secondary_command_buffer.VkHandle();
-    query_updates.emplace_back([sub_command_buffer](vvl::CommandBuffer& cb_state_arg, bool do_validate,
-                                                    VkQueryPool& first_perf_query_pool, uint32_t perf_query_pass,
-                                                    QueryMap* local_query_to_state_map) {
+    auto update = [sub_command_buffer](vvl::CommandBuffer& cb_state_arg, bool do_validate, VkQueryPool& first_perf_query_pool,
+                                       uint32_t perf_query_pass, QueryMap* local_query_to_state_map) {
         bool skip = false;
         auto secondary_cb_state_arg = cb_state_arg.dev_data.GetWrite<vvl::CommandBuffer>(sub_command_buffer);
         auto& secondary_sub_state_arg = SubState(*secondary_cb_state_arg);
@@ -1012,7 +1032,9 @@ void CommandBufferSubState::RecordExecuteCommand(vvl::CommandBuffer& secondary_c
                 function(*secondary_cb_state_arg, do_validate, first_perf_query_pool, perf_query_pass, local_query_to_state_map);
         }
         return skip;
-    });
+    };
+    static_assert(sizeof(update) <= kQueryCallbackCapacity, "Capture doesn't fit in QueryCallback");
+    query_updates.emplace_back(std::move(update));
 }
 
 void CommandBufferSubState::Submit(vvl::Queue& queue_state, uint32_t perf_submit_pass, const Location& loc) {
@@ -23,6 +23,7 @@
 #include "state_tracker/cmd_buffer_state.h"
 #include "state_tracker/queue_state.h"
 #include "state_tracker/event_map.h"
+#include "external/inplace_function.h"
 
 class CoreChecks;
 
@@ -171,16 +172,25 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
     // currently need to hold in Command buffer because it can be a suspended renderpassss
     std::vector<VkOffset2D> fragment_density_offsets;
 
+    // The submit time callbacks below are recorded per command (queries and events for every begin/end/set/wait), so they
+    // use stdext::inplace_function to keep the captures in place instead of heap allocating each closure.
+    // The capacities are sized for the largest lambda recorded into each vector, every capture site static_asserts it fits.
+    static constexpr size_t kQueueCallbackCapacity = 160;
+    static constexpr size_t kEventCallbackCapacity = 128;
+    static constexpr size_t kQueryCallbackCapacity = 128;
+
     // Validation functions run at primary CB queue submit time
-    using QueueCallback = std::function<bool(const class vvl::Queue &queue_state, const vvl::CommandBuffer &cb_state)>;
+    using QueueCallback = stdext::inplace_function<bool(const class vvl::Queue &queue_state, const vvl::CommandBuffer &cb_state),
+                                                   kQueueCallbackCapacity>;
     std::vector<QueueCallback> queue_submit_functions;
 
     // The subresources from dynamic rendering barriers that can't be validated during record time.
     vvl::unordered_map<VkImage, std::vector<std::pair<VkImageSubresourceRange, vvl::LocationCapture>>>
         submit_validate_dynamic_rendering_barrier_subresources;
 
-    using EventCallback = std::function<bool(vvl::CommandBuffer &cb_state, bool do_validate, EventMap &local_event_signal_info,
-                                             VkQueue waiting_queue, const Location &loc)>;
+    using EventCallback = stdext::inplace_function<bool(vvl::CommandBuffer &cb_state, bool do_validate,
+                                                        EventMap &local_event_signal_info, VkQueue waiting_queue, const Location &loc),
+                                                   kEventCallbackCapacity>;
     std::vector<EventCallback> event_updates;
 
     // Validation functions run when secondary CB is executed in primary
@@ -188,9 +198,11 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
         std::function<bool(const vvl::CommandBuffer &secondary, const vvl::CommandBuffer *primary, const vvl::Framebuffer *)>>
         cmd_execute_commands_functions;
 
-    std::vector<std::function<bool(vvl::CommandBuffer &cb_state, bool do_validate, VkQueryPool &first_perf_query_pool,
-                                   uint32_t perf_query_pass, QueryMap *local_query_to_state_map)>>
-        query_updates;
+    using QueryCallback = stdext::inplace_function<bool(vvl::CommandBuffer &cb_state, bool do_validate,
+                                                        VkQueryPool &first_perf_query_pool, uint32_t perf_query_pass,
+                                                        QueryMap *local_query_to_state_map),
+                                                   kQueryCallbackCapacity>;
+    std::vector<QueryCallback> query_updates;
 
   private:
     void ResetCBState();
@@ -236,6 +236,9 @@ class CoreChecks : public vvl::DeviceProxy {
                                       const VkPipelineLibraryCreateInfoKHR& link_info,
                                       const VkPipelineRenderingCreateInfo* rendering_struct, const Location& loc, int lib_index,
                                       const char* vuid) const;
+    // Calls validate(i) for each pipeline of a vkCreate*Pipelines batch, spreading large batches over the device worker pool.
+    // Errors are still reported in pCreateInfos order, on the calling thread.
+    bool ValidatePipelineBatch(uint32_t count, const std::function<bool(uint32_t)>& validate) const;
     bool ValidateGraphicsPipelineDerivatives(PipelineStates& pipeline_states, uint32_t pipe_index, const Location& loc) const;
     bool ValidateComputePipelineDerivatives(PipelineStates& pipeline_states, uint32_t pipe_index, const Location& loc) const;
     bool ValidateMultiViewShaders(const vvl::Pipeline& pipeline, const Location& multiview_loc, uint32_t view_mask,
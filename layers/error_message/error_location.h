@@ -144,6 +144,37 @@ struct LocationCapture {
     CaptureStore capture;
 };
 
+// A message that was logged while a ScopedLogDeferral was active
+struct DeferredLogMessage {
+    VkFlags msg_flags;
+    std::string vuid_text;
+    LogObjectList objects;
+    LocationCapture loc;
+    std::string main_message;
+};
+
+// Validation that runs on a worker thread can't call the debug callbacks directly, as the order of the messages would then
+// depend on thread scheduling. While this is alive, messages logged from the current thread are stored in |messages| and can be
+// reported later, in order, with DebugReport::LogDeferredMessages().
+// Until then the callbacks' return value is unknown, so logging a message returns |callback_result| (if the message isn't
+// filtered out). Use DebugReport::LastCallbackResult() to take the same path the validation would take serially.
+class ScopedLogDeferral {
+  public:
+    ScopedLogDeferral(std::vector<DeferredLogMessage>& messages, bool callback_result)
+        : prev_messages_(DebugReport::deferred_messages), prev_result_(DebugReport::deferred_messages_result) {
+        DebugReport::deferred_messages = &messages;
+        DebugReport::deferred_messages_result = callback_result;
+    }
+    ~ScopedLogDeferral() {
+        DebugReport::deferred_messages = prev_messages_;
+        DebugReport::deferred_messages_result = prev_result_;
+    }
+
+  private:
+    std::vector<DeferredLogMessage>* prev_messages_;
+    bool prev_result_;
+};
+
 // Key for use in tables of VUIDs.
 //
 // Fuzzy match rules:
@@ -97,8 +97,7 @@ void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
 }
 
 // We try to return as early as we can if we know we don't need to spend time logging the message
-bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
-                             const std::string &main_message) {
+bool DebugReport::IsMessageEnabled(VkFlags msg_flags, uint32_t vuid_hash) const {
     // Convert the info to the VK_EXT_debug_utils format
     VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
     VkDebugUtilsMessageTypeFlagsEXT msg_type;
@@ -108,8 +107,13 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
     }
 
     // If message is in filter list, bail out very early
+    return filter_message_ids.find(vuid_hash) == filter_message_ids.end();
+}
+
+bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
+                             const std::string &main_message) {
     const uint32_t vuid_hash = hash_util::VuidHash(vuid_text);
-    if (filter_message_ids.find(vuid_hash) != filter_message_ids.end()) {
+    if (!IsMessageEnabled(msg_flags, vuid_hash)) {
         return false;
     }
 
@@ -256,6 +260,7 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
             }
         }
     }
+    last_callback_result_.store(bail, std::memory_order_relaxed);
     return bail;
 }
 
@@ -715,12 +720,30 @@ VKAPI_ATTR void DeactivateInstanceDebugCallbacks(DebugReport *debug_report) {
     }
 }
 
+thread_local std::vector<vvl::DeferredLogMessage> *DebugReport::deferred_messages = nullptr;
+thread_local bool DebugReport::deferred_messages_result = false;
+
 bool DebugReport::LogMessageVaList(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
                                    const char *format, va_list argptr) {
-    const std::string main_message = text::VFormat(format, argptr);
+    std::string main_message = text::VFormat(format, argptr);
+    if (deferred_messages) {
+        // The callbacks are only called later by LogDeferredMessages, give the validation what they are expected to return
+        const bool bail = deferred_messages_result && IsMessageEnabled(msg_flags, hash_util::VuidHash(vuid_text));
+        deferred_messages->emplace_back(vvl::DeferredLogMessage{msg_flags, std::string(vuid_text), objects,
+                                                                vvl::LocationCapture(loc), std::move(main_message)});
+        return bail;
+    }
     return LogMessage(msg_flags, vuid_text, objects, loc, main_message);
 }
 
+bool DebugReport::LogDeferredMessages(const std::vector<vvl::DeferredLogMessage> &messages) {
+    bool bail = false;
+    for (const auto &message : messages) {
+        bail |= LogMessage(message.msg_flags, message.vuid_text, message.objects, message.loc.Get(), message.main_message);
+    }
+    return bail;
+}
+
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback([[maybe_unused]] VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
                                                       [[maybe_unused]] VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                       [[maybe_unused]] const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdarg>
 #include <mutex>
 #include <string>
@@ -174,6 +175,9 @@ class TypedHandleWrapper {
 };
 
 struct Location;
+namespace vvl {
+struct DeferredLogMessage;
+}  // namespace vvl
 
 struct MessageFormatSettings {
     bool json = false;
@@ -230,6 +234,16 @@ class DebugReport {
     // Formats messages to be in the proper format, handles VUID logic, any legacy issues, and finally calls the callback
     bool LogMessage(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
                     const std::string &main_message);
+    // Reports the messages captured by a vvl::ScopedLogDeferral, in order
+    // Returns true if any callback asked for the call to be skipped
+    bool LogDeferredMessages(const std::vector<vvl::DeferredLogMessage> &messages);
+    // What the callbacks returned for the last message sent to them, false (what the spec asks callbacks to return) until then
+    bool LastCallbackResult() const { return last_callback_result_.load(std::memory_order_relaxed); }
+
+    // When set, messages logged from this thread are stored here instead of being sent to the callbacks
+    static thread_local std::vector<vvl::DeferredLogMessage> *deferred_messages;
+    // What logging a message returns on this thread while deferred_messages is set, see vvl::ScopedLogDeferral
+    static thread_local bool deferred_messages_result;
 
     void BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
     void EndQueueDebugUtilsLabel(VkQueue queue);
@@ -242,12 +256,17 @@ class DebugReport {
     void EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer);
 
   private:
+    // Severity, type and message id filters, anything passing these is sent to the callbacks
+    bool IsMessageEnabled(VkFlags msg_flags, uint32_t vuid_hash) const;
+
     std::string CreateMessageText(const Location &loc, std::string_view vuid_text, const std::string &main_message,
                                   bool at_message_limit);
     std::string CreateMessageJson(VkFlags msg_flags, const Location &loc,
                                   const std::vector<VkDebugUtilsObjectNameInfoEXT> &object_name_infos, const uint32_t vuid_hash,
                                   std::string_view vuid_text, const std::string &main_message, bool at_message_limit);
 
+    std::atomic<bool> last_callback_result_{false};
+
     VkDebugUtilsMessageSeverityFlagsEXT active_msg_severities{0};
     VkDebugUtilsMessageTypeFlagsEXT active_msg_types{0};
     vvl::unordered_map<uint32_t, uint32_t> duplicate_message_count_map{};
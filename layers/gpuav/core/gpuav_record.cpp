@@ -151,6 +151,13 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
 
     indices_buffer_.Destroy();
 
+    if (use_instrumented_shader_cache_) {
+        if (instrumented_shader_cache_.IsModified() && !instrumented_shader_cache_.Save(instrumented_shader_cache_path_)) {
+            std::string message = "Cannot write instrumented shader cache to " + instrumented_shader_cache_path_;
+            InternalWarning(device, record_obj.location, message.c_str());
+        }
+    }
+
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 
     // State Tracker (BaseClass) can end up making vma calls through callbacks - so destroy allocator last
@@ -27,6 +27,11 @@ struct GpuAVSettings {
     bool force_on_robustness = false;
     bool select_instrumented_shaders = false;
     std::vector<std::string> shader_selection_regexes{};
+    bool cache_instrumented_shaders = false;
+    std::string instrumented_shader_cache_dir{};  // empty is the temporary directory
+    // Not settings, taken from VkApplicationInfo to keep a cache file per application
+    std::string application_name{};
+    std::string engine_name{};
 
     bool validate_indirect_draws_buffers = true;
     bool validate_indirect_dispatches_buffers = true;
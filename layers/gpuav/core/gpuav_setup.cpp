@@ -16,6 +16,7 @@
  */
 
 #include <array>
+#include <cctype>
 #include <cmath>
 #include <cstring>
 #include <string>
@@ -30,6 +31,7 @@
 #include "gpuav/shaders/gpuav_error_header.h"
 #include "gpuav/shaders/gpuav_shaders_constants.h"
 #include "utils/dispatch_utils.h"
+#include "utils/file_system_utils.h"
 
 namespace gpuav {
 
@@ -194,6 +196,20 @@ void Instance::PreCallRecordCreateDevice(VkPhysicalDevice physicalDevice, const
     AddFeatures(physicalDevice, modified_create_info, record_obj.location);
 }
 
+// Application and engine names can be anything, keep what is safe in a file name on every platform
+static std::string CacheFileNamePart(const std::string &name) {
+    constexpr size_t kMaxLength = 64;
+    std::string part;
+    for (const char c : name) {
+        if (part.size() == kMaxLength) {
+            break;
+        }
+        const bool safe = std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_';
+        part += safe ? c : '_';
+    }
+    return part.empty() ? "unnamed" : part;
+}
+
 // Perform initializations that can be done at Create Device time.
 void Validator::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) {
     // GPU-AV not supported, exit early to prevent errors inside Validator::PostCallRecordCreateDevice
@@ -234,6 +250,33 @@ void Validator::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const L
     // Need the device to be created before we can query features for settings
     InitSettings(loc);
 
+    // The debug settings are for looking at the instrumentation while it happens, don't skip it for them
+    if (gpuav_settings.cache_instrumented_shaders && !gpuav_settings.debug_validate_instrumented_shaders &&
+        !gpuav_settings.debug_dump_instrumented_shaders && !gpuav_settings.debug_print_instrumentation_info) {
+        const std::string cache_dir = gpuav_settings.instrumented_shader_cache_dir.empty()
+                                          ? GetTempFilePath()
+                                          : gpuav_settings.instrumented_shader_cache_dir;
+        // One file per application, so applications don't push each other's shaders out of the cache (or use up its shader ids)
+        instrumented_shader_cache_path_ = cache_dir + "/gpuav_instrumented_shader_cache-" +
+                                          CacheFileNamePart(gpuav_settings.application_name) + "-" +
+                                          CacheFileNamePart(gpuav_settings.engine_name);
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
+        instrumented_shader_cache_path_ += "-" + std::to_string(getuid());
+#endif
+        instrumented_shader_cache_path_ += ".bin";
+        // A missing or outdated file just means starting with an empty cache
+        instrumented_shader_cache_.Load(instrumented_shader_cache_path_);
+
+        // Cached shaders keep the id they were instrumented with, new ones are numbered after them.
+        // Start over before the cached ids use up the space for new shaders.
+        if (instrumented_shader_cache_.MaxShaderId() >= glsl::kMaxInstrumentedShaders / 2) {
+            instrumented_shader_cache_.Clear();
+        }
+        unique_shader_module_id_ = instrumented_shader_cache_.MaxShaderId() + 1;
+        instrumentation_settings_hash_ = GetInstrumentationSettingsHash();
+        use_instrumented_shader_cache_ = true;
+    }
+
     VkResult result = UtilInitializeVma(instance, physical_device, device, &vma_allocator_);
     if (result != VK_SUCCESS) {
         InternalVmaError(device, result, "Could not initialize VMA");
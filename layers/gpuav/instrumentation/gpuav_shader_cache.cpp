@@ -0,0 +1,253 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpuav/instrumentation/gpuav_shader_cache.h"
+
+#include <vulkan/vulkan_core.h>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <system_error>
+
+#include "utils/hash_util.h"
+
+#include <filesystem>
+namespace fs = std::filesystem;
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace gpuav {
+
+// File layout, all in 32-bit words:
+//   header: magic, format version, VK_HEADER_VERSION_COMPLETE, entry count, 64-bit checksum of the payload
+//   payload, per entry: 64-bit key, shader id, SPIR-V word count, SPIR-V words
+static constexpr uint32_t kMagic = 0x43564147;  // "GAVC"
+// Bump when the file layout changes
+static constexpr uint32_t kFormatVersion = 1;
+static constexpr size_t kHeaderWordCount = 6;
+static constexpr size_t kEntryHeaderWordCount = 4;
+
+static uint32_t GetProcessId() {
+#if defined(_WIN32)
+    return static_cast<uint32_t>(_getpid());
+#else
+    return static_cast<uint32_t>(getpid());
+#endif
+}
+
+bool InstrumentedShaderCache::ReadFile(const std::string &path, EntryMap &out_entries, uint32_t &out_max_shader_id) {
+    std::ifstream read_file(path, std::ios::in | std::ios::binary);
+    if (!read_file) {
+        return false;
+    }
+    std::vector<char> bytes((std::istreambuf_iterator<char>(read_file)), std::istreambuf_iterator<char>());
+    if (bytes.size() % sizeof(uint32_t) != 0 || bytes.size() < kHeaderWordCount * sizeof(uint32_t)) {
+        return false;
+    }
+    std::vector<uint32_t> words(bytes.size() / sizeof(uint32_t));
+    std::copy(bytes.begin(), bytes.end(), reinterpret_cast<char *>(words.data()));
+
+    if (words[0] != kMagic || words[1] != kFormatVersion || words[2] != VK_HEADER_VERSION_COMPLETE) {
+        return false;
+    }
+    const uint32_t entry_count = words[3];
+    const uint64_t checksum = uint64_t(words[4]) | (uint64_t(words[5]) << 32);
+    const uint32_t *payload = words.data() + kHeaderWordCount;
+    const size_t payload_word_count = words.size() - kHeaderWordCount;
+    if (hash_util::Hash64(payload, payload_word_count * sizeof(uint32_t)) != checksum) {
+        return false;
+    }
+
+    // Parse everything before handing it out so a truncated file gives nothing
+    EntryMap entries;
+    uint32_t max_shader_id = 0;
+    size_t offset = 0;
+    for (uint32_t i = 0; i < entry_count; ++i) {
+        if (payload_word_count - offset < kEntryHeaderWordCount) {
+            return false;
+        }
+        const uint64_t key = uint64_t(payload[offset]) | (uint64_t(payload[offset + 1]) << 32);
+        const uint32_t shader_id = payload[offset + 2];
+        const uint32_t spirv_word_count = payload[offset + 3];
+        offset += kEntryHeaderWordCount;
+        if (payload_word_count - offset < spirv_word_count) {
+            return false;
+        }
+        entries[key].emplace_back(
+            Entry{shader_id, false, std::vector<uint32_t>(payload + offset, payload + offset + spirv_word_count)});
+        max_shader_id = std::max(max_shader_id, shader_id);
+        offset += spirv_word_count;
+    }
+    out_entries = std::move(entries);
+    out_max_shader_id = max_shader_id;
+    return true;
+}
+
+bool InstrumentedShaderCache::Load(const std::string &path) {
+    EntryMap entries;
+    uint32_t max_shader_id = 0;
+    if (!ReadFile(path, entries, max_shader_id)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    entries_ = std::move(entries);
+    max_shader_id_ = max_shader_id;
+    modified_ = false;
+    cleared_ = false;
+    return true;
+}
+
+bool InstrumentedShaderCache::Save(const std::string &path) const {
+    // Another device (most likely in another process) may have saved the file since we loaded it
+    EntryMap on_disk_entries;
+    uint32_t on_disk_max_shader_id = 0;
+    ReadFile(path, on_disk_entries, on_disk_max_shader_id);
+
+    std::vector<uint32_t> words(kHeaderWordCount);
+    uint32_t entry_count = 0;
+    auto append = [&words, &entry_count](uint64_t key, const Entry &entry) {
+        words.push_back(static_cast<uint32_t>(key));
+        words.push_back(static_cast<uint32_t>(key >> 32));
+        words.push_back(entry.shader_id);
+        words.push_back(static_cast<uint32_t>(entry.spirv.size()));
+        words.insert(words.end(), entry.spirv.begin(), entry.spirv.end());
+        ++entry_count;
+    };
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        vvl::unordered_set<uint32_t> used_shader_ids;
+        for (const auto &[key, key_entries] : entries_) {
+            for (const Entry &entry : key_entries) {
+                append(key, entry);
+                if (!entry.spirv.empty()) {
+                    used_shader_ids.insert(entry.shader_id);
+                }
+            }
+        }
+        if (!cleared_) {
+            // Both of us numbered new shaders from the same starting point, so the other entries can reuse one of our ids for a
+            // different shader. One device can't have two shaders with the same id, ours win.
+            for (const auto &[key, key_entries] : on_disk_entries) {
+                if (entries_.find(key) != entries_.end()) {
+                    continue;
+                }
+                for (const Entry &entry : key_entries) {
+                    if (entry.spirv.empty() || used_shader_ids.insert(entry.shader_id).second) {
+                        append(key, entry);
+                    }
+                }
+            }
+        }
+    }
+    const uint64_t checksum =
+        hash_util::Hash64(words.data() + kHeaderWordCount, (words.size() - kHeaderWordCount) * sizeof(uint32_t));
+    words[0] = kMagic;
+    words[1] = kFormatVersion;
+    words[2] = VK_HEADER_VERSION_COMPLETE;
+    words[3] = entry_count;
+    words[4] = static_cast<uint32_t>(checksum);
+    words[5] = static_cast<uint32_t>(checksum >> 32);
+
+    // Write to the side and rename, another process reading the cache never sees a half written file.
+    // The temporary name must be unique, several processes (or devices) can be saving at the same time.
+    std::random_device random;
+    std::ostringstream temp_path;
+    temp_path << path << "." << GetProcessId() << "-" << std::hex << random() << random() << ".tmp";
+    {
+        std::ofstream write_file(temp_path.str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!write_file) {
+            return false;
+        }
+        write_file.write(reinterpret_cast<const char *>(words.data()), words.size() * sizeof(uint32_t));
+        if (!write_file) {
+            write_file.close();
+            std::error_code ec;
+            fs::remove(temp_path.str(), ec);
+            return false;
+        }
+    }
+    std::error_code ec;
+    fs::rename(temp_path.str(), path, ec);
+    if (ec) {
+        std::error_code remove_ec;
+        fs::remove(temp_path.str(), remove_ec);
+        return false;
+    }
+    return true;
+}
+
+InstrumentedShaderCache::Result InstrumentedShaderCache::Find(uint64_t key, uint32_t &out_shader_id,
+                                                              std::vector<uint32_t> &out_spirv) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        for (Entry &entry : it->second) {
+            if (entry.spirv.empty()) {
+                return Result::kNotInstrumented;
+            }
+            if (!entry.claimed) {
+                entry.claimed = true;
+                out_shader_id = entry.shader_id;
+                out_spirv = entry.spirv;
+                return Result::kInstrumented;
+            }
+        }
+    }
+    return Result::kMiss;
+}
+
+void InstrumentedShaderCache::AddInstrumented(uint64_t key, uint32_t shader_id, const std::vector<uint32_t> &spirv) {
+    std::lock_guard<std::mutex> guard(lock_);
+    entries_[key].emplace_back(Entry{shader_id, true, spirv});
+    max_shader_id_ = std::max(max_shader_id_, shader_id);
+    modified_ = true;
+}
+
+void InstrumentedShaderCache::AddNotInstrumented(uint64_t key) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &key_entries = entries_[key];
+    if (key_entries.empty()) {
+        key_entries.emplace_back(Entry{0, true, {}});
+        modified_ = true;
+    }
+}
+
+void InstrumentedShaderCache::Clear() {
+    std::lock_guard<std::mutex> guard(lock_);
+    entries_.clear();
+    max_shader_id_ = 0;
+    modified_ = true;
+    cleared_ = true;
+}
+
+uint32_t InstrumentedShaderCache::MaxShaderId() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return max_shader_id_;
+}
+
+bool InstrumentedShaderCache::IsModified() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return modified_;
+}
+
+}  // namespace gpuav
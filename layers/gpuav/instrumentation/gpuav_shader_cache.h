@@ -0,0 +1,74 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+namespace gpuav {
+
+// Instrumented SPIR-V from previous runs, loaded from disk at device creation and written back at device destruction, so an
+// application creating the same shaders every run only pays for the instrumentation once.
+//
+// The key is a hash of the original SPIR-V, the descriptor set layouts seen by the instrumentation and everything else
+// (settings, enabled features, instrumentation code) that changes the output.
+// The instrumented SPIR-V has the unique shader id baked in, so each entry remembers the id it was built with and a hit hands
+// that id back. An id can only be claimed once per device; the same shader used by a second pipeline is a miss and gets its
+// own entry.
+class InstrumentedShaderCache {
+  public:
+    enum class Result { kMiss, kInstrumented, kNotInstrumented };
+
+    // Returns false if the file does not exist or is not a valid cache for this version of the layer
+    bool Load(const std::string &path);
+    // Entries another process saved to the file since it was loaded are kept, unless they clash with ours
+    bool Save(const std::string &path) const;
+
+    // On kInstrumented, out_shader_id and out_spirv are the ones the shader was instrumented with
+    Result Find(uint64_t key, uint32_t &out_shader_id, std::vector<uint32_t> &out_spirv);
+    void AddInstrumented(uint64_t key, uint32_t shader_id, const std::vector<uint32_t> &spirv);
+    // The shader had nothing to instrument
+    void AddNotInstrumented(uint64_t key);
+    void Clear();
+
+    // Ids handed out for new shaders must start past this so they never collide with a cached one
+    uint32_t MaxShaderId() const;
+    bool IsModified() const;
+
+  private:
+    struct Entry {
+        uint32_t shader_id;
+        bool claimed;
+        // Empty if there was nothing to instrument
+        std::vector<uint32_t> spirv;
+    };
+    using EntryMap = vvl::unordered_map<uint64_t, std::vector<Entry>>;
+    static bool ReadFile(const std::string &path, EntryMap &out_entries, uint32_t &out_max_shader_id);
+
+    EntryMap entries_;
+    uint32_t max_shader_id_ = 0;
+    bool modified_ = false;
+    // Cleared to make room for new shader ids, so the entries on disk must not be merged back in
+    bool cleared_ = false;
+    mutable std::mutex lock_;
+};
+
+}  // namespace gpuav
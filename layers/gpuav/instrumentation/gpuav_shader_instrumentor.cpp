@@ -22,8 +22,10 @@
 #include "error_message/error_location.h"
 #include "generated/vk_extension_helper.h"
 #include "generated/dispatch_functions.h"
+#include "generated/gpuav_offline_spirv.h"
 #include "chassis/chassis_modification_state.h"
 #include "utils/shader_utils.h"
+#include "utils/hash_util.h"
 
 #include "gpuav/shaders/gpuav_shaders_constants.h"
 #include "gpuav/shaders/gpuav_error_codes.h"
@@ -326,7 +328,7 @@ bool GpuShaderInstrumentor::PreCallRecordShaderObjectInstrumentation(
     InstrumentationDescriptorSetLayouts instrumentation_dsl;
     BuildDescriptorSetLayoutInfo(modified_create_info, instrumentation_dsl);
 
-    const uint32_t unique_shader_id = unique_shader_module_id_++;
+    uint32_t unique_shader_id = unique_shader_module_id_++;
     const bool is_shader_instrumented = InstrumentShader(
         vvl::make_span(static_cast<const uint32_t *>(modified_create_info.pCode), modified_create_info.codeSize / sizeof(uint32_t)),
         unique_shader_id, instrumentation_dsl, create_info_loc, instrumented_spirv);
@@ -974,7 +976,7 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
             }
         }
         std::vector<uint32_t> instrumented_spirv;
-        const uint32_t unique_shader_id = unique_shader_module_id_++;
+        uint32_t unique_shader_id = unique_shader_module_id_++;
         const bool is_shader_instrumented =
             InstrumentShader(modified_module_state->spirv->words_, unique_shader_id, instrumentation_dsl, loc, instrumented_spirv);
         if (is_shader_instrumented) {
@@ -1127,7 +1129,7 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
             // Instrument shader
             // ---
             std::vector<uint32_t> instrumented_spirv;
-            const uint32_t unique_shader_id = unique_shader_module_id_++;
+            uint32_t unique_shader_id = unique_shader_module_id_++;
             const bool is_shader_instrumented = InstrumentShader(modified_module_state->spirv->words_, unique_shader_id,
                                                                  instrumentation_dsl, loc, instrumented_spirv);
 
@@ -1264,12 +1266,83 @@ static bool GpuValidateShader(const std::vector<uint32_t> &input, bool SetRelaxB
     return (result == SPV_SUCCESS);
 }
 
+uint64_t GpuShaderInstrumentor::GetInstrumentationSettingsHash() const {
+    const bool support_non_semantic_info =
+        IsExtEnabled(extensions.vk_khr_shader_non_semantic_info) && !IsExtEnabled(extensions.vk_khr_portability_subset);
+    const uint32_t settings[] = {
+        instrumentation_desc_set_bind_index_,
+        gpuav_settings.safe_mode,
+        gpuav_settings.debug_max_instrumentations_count,
+        support_non_semantic_info,
+        gpuav_settings.shader_instrumentation.descriptor_checks,
+        gpuav_settings.shader_instrumentation.buffer_device_address,
+        gpuav_settings.shader_instrumentation.ray_query,
+        gpuav_settings.shader_instrumentation.post_process_descriptor_indexing,
+        gpuav_settings.shader_instrumentation.vertex_attribute_fetch_oob,
+        gpuav_settings.debug_printf_enabled,
+        api_version.Value(),
+    };
+    // The GLSL functions linked into the shaders are part of the output as well, this catches most changes of the layer itself
+    const std::pair<const uint32_t *, uint32_t> offline_modules[] = {
+        {instrumentation_buffer_device_address_comp, instrumentation_buffer_device_address_comp_size},
+        {instrumentation_descriptor_class_general_buffer_comp, instrumentation_descriptor_class_general_buffer_comp_size},
+        {instrumentation_descriptor_class_texel_buffer_comp, instrumentation_descriptor_class_texel_buffer_comp_size},
+        {instrumentation_descriptor_indexing_oob_comp, instrumentation_descriptor_indexing_oob_comp_size},
+        {instrumentation_log_error_comp, instrumentation_log_error_comp_size},
+        {instrumentation_post_process_descriptor_index_comp, instrumentation_post_process_descriptor_index_comp_size},
+        {instrumentation_ray_query_comp, instrumentation_ray_query_comp_size},
+        {instrumentation_vertex_attribute_fetch_oob_vert, instrumentation_vertex_attribute_fetch_oob_vert_size},
+    };
+
+    std::vector<uint64_t> hashes;
+    hashes.emplace_back(hash_util::Hash64(settings, sizeof(settings)));
+    hashes.emplace_back(hash_util::Hash64(&modified_features, sizeof(modified_features)));
+    for (const auto &[words, word_count] : offline_modules) {
+        hashes.emplace_back(hash_util::Hash64(words, word_count * sizeof(uint32_t)));
+    }
+    return hash_util::Hash64(hashes.data(), hashes.size() * sizeof(uint64_t));
+}
+
+uint64_t GpuShaderInstrumentor::GetInstrumentedShaderCacheKey(
+    const vvl::span<const uint32_t> &input_spirv, const InstrumentationDescriptorSetLayouts &instrumentation_dsl) const {
+    std::vector<uint32_t> layout_words;
+    layout_words.emplace_back(instrumentation_dsl.has_bindless_descriptors);
+    for (const auto &set_bindings : instrumentation_dsl.set_index_to_bindings_layout_lut) {
+        layout_words.emplace_back(static_cast<uint32_t>(set_bindings.size()));
+        for (const spirv::BindingLayout &binding_layout : set_bindings) {
+            layout_words.emplace_back(binding_layout.start);
+            layout_words.emplace_back(binding_layout.count);
+        }
+    }
+    const uint64_t hashes[] = {
+        instrumentation_settings_hash_,
+        hash_util::Hash64(layout_words.data(), layout_words.size() * sizeof(uint32_t)),
+        hash_util::Hash64(input_spirv.data(), input_spirv.size() * sizeof(uint32_t)),
+    };
+    return hash_util::Hash64(hashes, sizeof(hashes));
+}
+
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
-bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
+bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t &unique_shader_id,
                                              const InstrumentationDescriptorSetLayouts &instrumentation_dsl, const Location &loc,
                                              std::vector<uint32_t> &out_instrumented_spirv) {
     if (input_spirv[0] != spv::MagicNumber) return false;
 
+    uint64_t cache_key = 0;
+    if (use_instrumented_shader_cache_) {
+        cache_key = GetInstrumentedShaderCacheKey(input_spirv, instrumentation_dsl);
+        uint32_t cached_shader_id = 0;
+        switch (instrumented_shader_cache_.Find(cache_key, cached_shader_id, out_instrumented_spirv)) {
+            case InstrumentedShaderCache::Result::kInstrumented:
+                unique_shader_id = cached_shader_id;
+                return true;
+            case InstrumentedShaderCache::Result::kNotInstrumented:
+                return false;
+            case InstrumentedShaderCache::Result::kMiss:
+                break;
+        }
+    }
+
     if (unique_shader_id >= glsl::kMaxInstrumentedShaders) {
         InternalWarning(device, loc, "kMaxInstrumentedShaders limit has been hit, no shaders can be instrumented.");
         return false;
@@ -1295,6 +1368,8 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
                          instrumentation_dsl.set_index_to_bindings_layout_lut);
 
     bool modified = false;
+    // Strings of internal debug printf calls are only saved while instrumenting, don't cache shaders that have them
+    const size_t internal_debug_printf_count = intenral_only_debug_printf_.size();
 
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
     if (gpuav_settings.shader_instrumentation.descriptor_checks) {
@@ -1362,6 +1437,9 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
 
     // If nothing was instrumented, leave early to save time
     if (!modified) {
+        if (use_instrumented_shader_cache_) {
+            instrumented_shader_cache_.AddNotInstrumented(cache_key);
+        }
         return false;
     }
 
@@ -1401,6 +1479,10 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
         DumpSpirvToFile(instrumented_spirv_file.string(), out_instrumented_spirv.data(), out_instrumented_spirv.size());
     }
 
+    if (use_instrumented_shader_cache_ && intenral_only_debug_printf_.size() == internal_debug_printf_count) {
+        instrumented_shader_cache_.AddInstrumented(cache_key, unique_shader_id, out_instrumented_spirv);
+    }
+
     return true;
 }
 
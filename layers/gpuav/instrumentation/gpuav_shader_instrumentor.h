@@ -20,6 +20,7 @@
 #include "state_tracker/shader_instruction.h"
 #include "state_tracker/state_tracker.h"
 #include "gpuav/spirv/interface.h"
+#include "gpuav/instrumentation/gpuav_shader_cache.h"
 #include "containers/custom_containers.h"
 
 #include <vector>
@@ -203,10 +204,20 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
 
     // GPU-AV and DebugPrint are using the same way to do the actual shader instrumentation logic
     // Returns if shader was instrumented successfully or not
-    bool InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
+    // If the instrumented shader comes from the cache, unique_shader_id is replaced by the id it was instrumented with
+    bool InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t &unique_shader_id,
                           const InstrumentationDescriptorSetLayouts &instrumentation_dsl, const Location &loc,
                           std::vector<uint32_t> &out_instrumented_spirv);
 
+    // Hash of everything other than the shader and descriptor set layouts that changes the output of InstrumentShader
+    uint64_t GetInstrumentationSettingsHash() const;
+    uint64_t GetInstrumentedShaderCacheKey(const vvl::span<const uint32_t> &input_spirv,
+                                           const InstrumentationDescriptorSetLayouts &instrumentation_dsl) const;
+
+    bool use_instrumented_shader_cache_ = false;
+    uint64_t instrumentation_settings_hash_ = 0;
+    InstrumentedShaderCache instrumented_shader_cache_;
+
   public:
     VkDescriptorSetLayout GetInstrumentationDescriptorSetLayout() { return instrumentation_desc_layout_; }
     VkPipelineLayout GetInstrumentationPipelineLayout() { return instrumentation_pipeline_layout_; }
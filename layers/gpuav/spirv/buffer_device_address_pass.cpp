@@ -115,6 +115,10 @@ uint32_t BufferDeviceAddressPass::CreateFunctionCall(BasicBlock& block, Instruct
     return 0;  // unsafe mode, we don't care what this is
 }
 
+uint32_t BufferDeviceAddressPass::OpcodeClassesOfInterest() const {
+    return kOpcodeClassLoad | kOpcodeClassStore | kOpcodeClassAtomic;
+}
+
 bool BufferDeviceAddressPass::RequiresInstrumentation(const Function& function, const Instruction& inst, InstructionMeta& meta) {
     const uint32_t opcode = inst.Opcode();
     if (opcode == spv::OpLoad || opcode == spv::OpStore) {
@@ -180,7 +184,7 @@ bool BufferDeviceAddressPass::RequiresInstrumentation(const Function& function,
 bool BufferDeviceAddressPass::Instrument() {
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (const auto& function : module_.functions_) {
-        if (function->instrumentation_added_) continue;
+        if (function->instrumentation_added_ || !HasOpcodeOfInterest(*function)) continue;
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
             BasicBlock& current_block = **block_it;
 
@@ -30,6 +30,7 @@ class BufferDeviceAddressPass : public Pass {
     const char* Name() const final { return "BufferDeviceAddressPass"; }
     bool Instrument() final;
     void PrintDebugInfo() const final;
+    uint32_t OpcodeClassesOfInterest() const final;
 
   private:
     // This is metadata tied to a single instruction gathered during RequiresInstrumentation() to be used later
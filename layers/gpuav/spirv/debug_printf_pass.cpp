@@ -42,6 +42,8 @@ uint32_t DebugPrintfPass::GetLinkFunctionId(uint32_t argument_count) {
     return link_function_id;
 }
 
+uint32_t DebugPrintfPass::OpcodeClassesOfInterest() const { return kOpcodeClassExtInst; }
+
 bool DebugPrintfPass::RequiresInstrumentation(const Instruction& inst, InstructionMeta& meta) {
     if (inst.Opcode() == spv::OpExtInst && inst.Word(3) == ext_import_id_ && inst.Word(4) == NonSemanticDebugPrintfDebugPrintf) {
         meta.target_instruction = &inst;
@@ -495,6 +497,7 @@ bool DebugPrintfPass::Instrument() {
     }
 
     for (const auto& function : module_.functions_) {
+        if (!HasOpcodeOfInterest(*function)) continue;
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
             BasicBlock& current_block = **block_it;
 
@@ -35,6 +35,7 @@ class DebugPrintfPass : public Pass {
 
     bool Instrument() final;
     void PrintDebugInfo() const final;
+    uint32_t OpcodeClassesOfInterest() const final;
 
   private:
     // This is metadata tied to a single instruction gathered during RequiresInstrumentation() to be used later
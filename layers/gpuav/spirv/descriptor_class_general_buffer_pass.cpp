@@ -67,6 +67,11 @@ void DescriptorClassGeneralBufferPass::CreateFunctionCall(BasicBlock& block, Ins
     module_.need_log_error_ = true;
 }
 
+uint32_t DescriptorClassGeneralBufferPass::OpcodeClassesOfInterest() const {
+    // Only OpAtomicStore, OpAtomicLoad and OpAtomicExchange of the atomics are instrumented
+    return kOpcodeClassLoad | kOpcodeClassStore | kOpcodeClassAtomic;
+}
+
 bool DescriptorClassGeneralBufferPass::RequiresInstrumentation(const Function& function, const Instruction& inst,
                                                                InstructionMeta& meta) {
     const uint32_t opcode = inst.Opcode();
@@ -170,7 +175,7 @@ bool DescriptorClassGeneralBufferPass::Instrument() {
 
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (const auto& function : module_.functions_) {
-        if (function->instrumentation_added_) continue;
+        if (function->instrumentation_added_ || !HasOpcodeOfInterest(*function)) continue;
 
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
             BasicBlock& current_block = **block_it;
@@ -29,6 +29,7 @@ class DescriptorClassGeneralBufferPass : public Pass {
 
     bool Instrument() final;
     void PrintDebugInfo() const final;
+    uint32_t OpcodeClassesOfInterest() const final;
 
   private:
     // This is metadata tied to a single instruction gathered during RequiresInstrumentation() to be used later
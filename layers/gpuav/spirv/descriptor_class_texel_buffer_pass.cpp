@@ -73,6 +73,8 @@ void DescriptorClassTexelBufferPass::CreateFunctionCall(BasicBlock& block, Instr
     module_.need_log_error_ = true;
 }
 
+uint32_t DescriptorClassTexelBufferPass::OpcodeClassesOfInterest() const { return kOpcodeClassTexelAccess; }
+
 bool DescriptorClassTexelBufferPass::RequiresInstrumentation(const Function& function, const Instruction& inst,
                                                              InstructionMeta& meta) {
     const uint32_t opcode = inst.Opcode();
@@ -175,7 +177,7 @@ bool DescriptorClassTexelBufferPass::Instrument() {
 
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (const auto& function : module_.functions_) {
-        if (function->instrumentation_added_) continue;
+        if (function->instrumentation_added_ || !HasOpcodeOfInterest(*function)) continue;
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
             BasicBlock& current_block = **block_it;
 
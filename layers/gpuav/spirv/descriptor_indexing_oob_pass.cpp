@@ -132,6 +132,10 @@ uint32_t DescriptorIndexingOOBPass::CreateFunctionCall(BasicBlock& block, Instru
     return function_result;
 }
 
+uint32_t DescriptorIndexingOOBPass::OpcodeClassesOfInterest() const {
+    return kOpcodeClassLoad | kOpcodeClassStore | kOpcodeClassAtomic | kOpcodeClassImageAccess;
+}
+
 bool DescriptorIndexingOOBPass::RequiresInstrumentation(const Function& function, const Instruction& inst, InstructionMeta& meta) {
     const uint32_t opcode = inst.Opcode();
 
@@ -381,7 +385,7 @@ bool DescriptorIndexingOOBPass::Instrument() {
 
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (const auto& function : module_.functions_) {
-        if (function->instrumentation_added_) continue;
+        if (function->instrumentation_added_ || !HasOpcodeOfInterest(*function)) continue;
 
         FunctionDuplicateTracker function_duplicate_tracker;
 
@@ -28,6 +28,7 @@ class DescriptorIndexingOOBPass : public Pass {
     const char* Name() const final { return "DescriptorIndexingOOBPass"; }
     bool Instrument() final;
     void PrintDebugInfo() const final;
+    uint32_t OpcodeClassesOfInterest() const final;
 
   private:
     // This is metadata tied to a single instruction gathered during RequiresInstrumentation() to be used later
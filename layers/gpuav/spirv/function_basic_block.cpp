@@ -14,6 +14,7 @@
  */
 
 #include "function_basic_block.h"
+#include "generated/spirv_grammar_helper.h"
 #include "state_tracker/shader_instruction.h"
 #include "module.h"
 
@@ -38,8 +39,37 @@ void Function::ToBinary(std::vector<uint32_t>& out) {
     }
 }
 
+uint32_t GetOpcodeClasses(uint32_t opcode) {
+    uint32_t classes = kOpcodeClassAny;
+    switch (opcode) {
+        case spv::OpLoad:
+            return classes | kOpcodeClassLoad;
+        case spv::OpStore:
+            return classes | kOpcodeClassStore;
+        case spv::OpImageFetch:
+        case spv::OpImageRead:
+        case spv::OpImageWrite:
+            classes |= kOpcodeClassTexelAccess;
+            break;
+        case spv::OpRayQueryInitializeKHR:
+            return classes | kOpcodeClassRayQueryInitialize;
+        case spv::OpExtInst:
+            return classes | kOpcodeClassExtInst;
+        default:
+            break;
+    }
+    if (AtomicOperation(opcode)) {
+        classes |= kOpcodeClassAtomic;
+    }
+    if (OpcodeImageAccessPosition(opcode) != 0) {
+        classes |= kOpcodeClassImageAccess;
+    }
+    return classes;
+}
+
 BasicBlock::BasicBlock(std::unique_ptr<Instruction> label, Function& function) : function_(function) {
     // Used when loading initial SPIR-V
+    function_.opcode_classes_ |= kOpcodeClassAny;
     instructions_.emplace_back(std::move(label));  // OpLabel
 }
 
@@ -95,6 +125,7 @@ void BasicBlock::CreateInstruction(spv::Op opcode, const std::vector<uint32_t>&
     if (result_id != 0) {
         function_.inst_map_[result_id] = new_inst.get();
     }
+    function_.opcode_classes_ |= GetOpcodeClasses(opcode);
 
     InstructionIt it = instructions_.insert(*inst_it, std::move(new_inst));
     // update after insertion because allows for easy adding of multiple instructions.
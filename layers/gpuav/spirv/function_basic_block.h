@@ -35,6 +35,19 @@ using Instruction = ::spirv::Instruction;
 using InstructionList = std::vector<std::unique_ptr<Instruction>>;
 using InstructionIt = InstructionList::iterator;
 
+// The kinds of instructions the passes look for, tracked per function so a pass can skip functions without any of them
+enum OpcodeClass : uint32_t {
+    kOpcodeClassAny = 1u << 0,  // every opcode has it
+    kOpcodeClassLoad = 1u << 1,
+    kOpcodeClassStore = 1u << 2,
+    kOpcodeClassAtomic = 1u << 3,
+    kOpcodeClassImageAccess = 1u << 4,
+    kOpcodeClassTexelAccess = 1u << 5,  // OpImageFetch, OpImageRead and OpImageWrite
+    kOpcodeClassRayQueryInitialize = 1u << 6,
+    kOpcodeClassExtInst = 1u << 7,
+};
+uint32_t GetOpcodeClasses(uint32_t opcode);
+
 // Since CFG analysis/manipulation is not a main focus, Blocks/Funcitons are just simple containers for ordering Instructions
 struct BasicBlock {
     // Used when loading initial SPIR-V
@@ -104,6 +117,10 @@ struct Function {
     vvl::unordered_map<uint32_t, const Instruction*> inst_map_;
     const Instruction* FindInstruction(uint32_t id) const;
 
+    // OpcodeClass of every opcode that was ever added to the blocks of this function, lets a pass skip functions with nothing it
+    // looks for. Instructions being moved or removed do not update it, so it can only have extra classes, never miss one.
+    uint32_t opcode_classes_ = 0;
+
     // A slower version of BasicBlock::CreateInstruction() that will search the entire function for |id| and then inject the
     // instruction after. Only to be used if you need to suddenly walk back to find an instruction, but normally instructions should
     // be added as you go forward only.
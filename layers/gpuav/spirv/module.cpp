@@ -218,6 +218,7 @@ Module::Module(vvl::span<const uint32_t> words, DebugReport* debug_report, const
         } else if (function_end_found) {
             current_function->post_block_inst_.emplace_back(std::move(new_inst));
         } else if (block_found) {
+            current_function->opcode_classes_ |= GetOpcodeClasses(opcode);
             current_block->instructions_.emplace_back(std::move(new_inst));
         } else {
             current_function->pre_block_inst_.emplace_back(std::move(new_inst));
@@ -693,6 +694,7 @@ void Module::LinkFunctions(const LinkInfo& info) {
 
             if (link_basic_block) {
                 // Need for a possible FindInstruction() lookup
+                new_function->opcode_classes_ |= GetOpcodeClasses(opcode);
                 link_basic_block->instructions_.emplace_back(std::move(new_inst));
             } else {
                 new_function->pre_block_inst_.emplace_back(std::move(new_inst));
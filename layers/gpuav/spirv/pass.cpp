@@ -27,7 +27,14 @@ namespace gpuav {
 namespace spirv {
 
 bool Pass::Run() {
-    const bool modified = Instrument();
+    // Most shaders only contain a few of the opcodes the passes look for, don't walk the module if nothing can be instrumented
+    bool modified = false;
+    for (const auto& function : module_.functions_) {
+        if (HasOpcodeOfInterest(*function)) {
+            modified = Instrument();
+            break;
+        }
+    }
     if (module_.settings_.print_debug_info) {
         PrintDebugInfo();
     }
@@ -39,6 +46,10 @@ bool Pass::Run() {
     return modified;
 }
 
+bool Pass::HasOpcodeOfInterest(const Function& function) const {
+    return (function.opcode_classes_ & OpcodeClassesOfInterest()) != 0;
+}
+
 const Variable& Pass::GetBuiltinVariable(uint32_t built_in) {
     uint32_t variable_id = 0;
     for (const auto& annotation : module_.annotations_) {
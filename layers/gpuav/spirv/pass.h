@@ -49,9 +49,15 @@ class Pass {
     virtual bool Instrument() = 0;
     // Requiring because this becomes important/helpful while debugging
     virtual void PrintDebugInfo() const = 0;
+    // OpcodeClass mask of the opcodes the pass might instrument, anything else is never looked at.
+    // Passes that don't work off specific instructions (ex. adding things at the entry point) keep the default
+    virtual uint32_t OpcodeClassesOfInterest() const { return kOpcodeClassAny; }
     // Wrapper that each pass can use to start
     bool Run();
 
+    // Lets a pass skip walking every block of a function that has nothing for it
+    bool HasOpcodeOfInterest(const Function& function) const;
+
     // Finds (and creates if needed) decoration and returns the OpVariable it points to
     const Variable& GetBuiltinVariable(uint32_t built_in);
 
@@ -57,6 +57,10 @@ void PostProcessDescriptorIndexingPass::CreateFunctionCall(BasicBlock& block, In
                             inst_it);
 }
 
+uint32_t PostProcessDescriptorIndexingPass::OpcodeClassesOfInterest() const {
+    return kOpcodeClassLoad | kOpcodeClassStore | kOpcodeClassImageAccess;
+}
+
 bool PostProcessDescriptorIndexingPass::RequiresInstrumentation(const Function& function, const Instruction& inst,
                                                                 InstructionMeta& meta) {
     const uint32_t opcode = inst.Opcode();
@@ -168,7 +172,7 @@ bool PostProcessDescriptorIndexingPass::Instrument() {
     }
 
     for (const auto& function : module_.functions_) {
-        if (function->instrumentation_added_) continue;
+        if (function->instrumentation_added_ || !HasOpcodeOfInterest(*function)) continue;
 
         FunctionDuplicateTracker function_duplicate_tracker;
 
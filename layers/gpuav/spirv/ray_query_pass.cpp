@@ -55,6 +55,8 @@ uint32_t RayQueryPass::CreateFunctionCall(BasicBlock& block, InstructionIt* inst
     return function_result;
 }
 
+uint32_t RayQueryPass::OpcodeClassesOfInterest() const { return kOpcodeClassRayQueryInitialize; }
+
 bool RayQueryPass::RequiresInstrumentation(const Function& function, const Instruction& inst, InstructionMeta& meta) {
     (void)function;
     const uint32_t opcode = inst.Opcode();
@@ -68,7 +70,7 @@ bool RayQueryPass::RequiresInstrumentation(const Function& function, const Instr
 bool RayQueryPass::Instrument() {
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (const auto& function : module_.functions_) {
-        if (function->instrumentation_added_) continue;
+        if (function->instrumentation_added_ || !HasOpcodeOfInterest(*function)) continue;
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
             BasicBlock& current_block = **block_it;
 
@@ -27,6 +27,7 @@ class RayQueryPass : public Pass {
     const char* Name() const final { return "RayQueryPass"; }
     bool Instrument() final;
     void PrintDebugInfo() const final;
+    uint32_t OpcodeClassesOfInterest() const final;
 
   private:
     // This is metadata tied to a single instruction gathered during RequiresInstrumentation() to be used later
@@ -198,6 +198,8 @@ const char *VK_LAYER_GPUAV_POST_PROCESS_DESCRIPTOR_INDEXING = "gpuav_post_proces
 const char *VK_LAYER_GPUAV_VERTEX_ATTRIBUTE_FETCH_OOB = "gpuav_vertex_attribute_fetch_oob";
 const char *VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS = "gpuav_select_instrumented_shaders";
 const char *VK_LAYER_GPUAV_SHADERS_TO_INSTRUMENT = "gpuav_shaders_to_instrument";
+const char *VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS = "gpuav_cache_instrumented_shaders";
+const char *VK_LAYER_GPUAV_INSTRUMENTED_SHADER_CACHE_DIR = "gpuav_instrumented_shader_cache_dir";
 
 const char *VK_LAYER_GPUAV_BUFFERS_VALIDATION = "gpuav_buffers_validation";
 const char *VK_LAYER_GPUAV_INDIRECT_DRAWS_BUFFERS = "gpuav_indirect_draws_buffers";
@@ -222,6 +224,9 @@ const char *VK_LAYER_GPUAV_DEBUG_PRINT_INSTRUMENTATION_INFO = "gpuav_debug_print
 const char *VK_LAYER_SYNCVAL_SUBMIT_TIME_VALIDATION = "syncval_submit_time_validation";
 const char *VK_LAYER_SYNCVAL_SHADER_ACCESSES_HEURISTIC = "syncval_shader_accesses_heuristic";
 const char *VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES = "syncval_message_extra_properties";
+const char *VK_LAYER_SYNCVAL_RETAINED_MEMORY_LIMIT = "syncval_retained_memory_limit";
+const char *VK_LAYER_SYNCVAL_STATS = "syncval_stats";
+const char *VK_LAYER_SYNCVAL_STATS_REPORT_PERIOD = "syncval_stats_report_period";
 
 // Message Formatting
 // ---
@@ -596,6 +601,10 @@ static void ValidateLayerSettingsProvided(const VkLayerSettingsCreateInfoEXT *la
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_GPUAV_SHADERS_TO_INSTRUMENT, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_STRING_EXT;
+        } else if (strcmp(VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
+        } else if (strcmp(VK_LAYER_GPUAV_INSTRUMENTED_SHADER_CACHE_DIR, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_STRING_EXT;
         } else if (strcmp(VK_LAYER_GPUAV_BUFFERS_VALIDATION, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_GPUAV_INDIRECT_DRAWS_BUFFERS, setting.pSettingName) == 0) {
@@ -614,6 +623,12 @@ static void ValidateLayerSettingsProvided(const VkLayerSettingsCreateInfoEXT *la
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
+        } else if (strcmp(VK_LAYER_SYNCVAL_RETAINED_MEMORY_LIMIT, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_UINT32_EXT;
+        } else if (strcmp(VK_LAYER_SYNCVAL_STATS, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
+        } else if (strcmp(VK_LAYER_SYNCVAL_STATS_REPORT_PERIOD, setting.pSettingName) == 0) {
+            required_type = VK_LAYER_SETTING_TYPE_UINT32_EXT;
         } else if (strcmp(VK_LAYER_MESSAGE_FORMAT_JSON, setting.pSettingName) == 0) {
             required_type = VK_LAYER_SETTING_TYPE_BOOL32_EXT;
         } else if (strcmp(VK_LAYER_MESSAGE_FORMAT_DISPLAY_APPLICATION_NAME, setting.pSettingName) == 0) {
@@ -1041,6 +1056,16 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
             gpuav_settings.SetShaderSelectionRegexes(std::move(shaders_to_instrument));
         }
 
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS,
+                                    gpuav_settings.cache_instrumented_shaders);
+        }
+        if (gpuav_settings.cache_instrumented_shaders &&
+            vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_INSTRUMENTED_SHADER_CACHE_DIR)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_INSTRUMENTED_SHADER_CACHE_DIR,
+                                    gpuav_settings.instrumented_shader_cache_dir);
+        }
+
         // No need to enable shader instrumentation options is no instrumentation is done
         if (!gpuav_settings.IsShaderInstrumentationEnabled()) {
             gpuav_settings.DisableShaderInstrumentationAndOptions();
@@ -1149,6 +1174,19 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                 syncval_settings.message_extra_properties);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_RETAINED_MEMORY_LIMIT)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_RETAINED_MEMORY_LIMIT,
+                                syncval_settings.retained_memory_limit);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_STATS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_STATS, syncval_settings.stats);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_STATS_REPORT_PERIOD)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_STATS_REPORT_PERIOD, syncval_settings.stats_report_period);
+    }
+
     const char *REMOVED_VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES_PRETTY_PRINT = "syncval_message_extra_properties_pretty_print";
     if (vkuHasLayerSetting(layer_setting_set, REMOVED_VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES_PRETTY_PRINT)) {
         setting_warnings.emplace_back(std::string(REMOVED_VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES_PRETTY_PRINT) +
@@ -1289,6 +1327,13 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         settings_data->debug_report->message_format_settings.application_name =
             (app_info && app_info->pApplicationName) ? app_info->pApplicationName : "";
     }
+    if (gpuav_settings.cache_instrumented_shaders) {
+        const VkApplicationInfo *app_info = settings_data->create_info->pApplicationInfo;
+        if (app_info) {
+            gpuav_settings.application_name = app_info->pApplicationName ? app_info->pApplicationName : "";
+            gpuav_settings.engine_name = app_info->pEngineName ? app_info->pEngineName : "";
+        }
+    }
 
     for (const auto &warning : setting_warnings) {
         Location loc(vvl::Func::vkCreateInstance);
@@ -269,8 +269,9 @@ void CommandBuffer::ResetCBState() {
     active_queries.clear();
     started_queries.clear();
     render_pass_queries.clear();
-    image_layout_registry.clear();
     aliased_image_layout_map.clear();
+    RecycleImageLayoutMaps();
+    image_layout_registry.clear();
     current_vertex_buffer_binding_info.clear();
     primary_command_buffer = VK_NULL_HANDLE;
     linked_command_buffers.clear();
@@ -316,6 +317,7 @@ void CommandBuffer::Destroy() {
     {
         auto guard = WriteLock();
         ResetCBState();
+        image_layout_map_pool_.clear();
     }
     for (auto &item : sub_states_) {
         item.second->Destroy();
@@ -403,16 +405,14 @@ std::shared_ptr<CommandBufferImageLayoutMap> CommandBuffer::GetOrCreateImageLayo
         if (alias_iter != aliased_image_layout_map.end()) {
             image_layout_map = alias_iter->second;
         } else {
-            image_layout_map = std::make_shared<CommandBufferImageLayoutMap>(image_state.subresource_encoder.SubresourceCount(),
-                                                                             image_state.GetId());
+            image_layout_map = NewImageLayoutMap(image_state);
             // Save the local layout map for the next aliased image.
             // The global layout map pointer is only used as a key into the local lookup
             // table so it doesn't need to be locked.
             aliased_image_layout_map.emplace(p_global_layout_map, image_layout_map);
         }
     } else {
-        image_layout_map =
-            std::make_shared<CommandBufferImageLayoutMap>(image_state.subresource_encoder.SubresourceCount(), image_state.GetId());
+        image_layout_map = NewImageLayoutMap(image_state);
     }
     if (iter != image_layout_registry.end()) {
         // overwrite the stale entry
@@ -424,11 +424,39 @@ std::shared_ptr<CommandBufferImageLayoutMap> CommandBuffer::GetOrCreateImageLayo
     return image_layout_map;
 }
 
+std::shared_ptr<CommandBufferImageLayoutMap> CommandBuffer::NewImageLayoutMap(const vvl::Image &image_state) {
+    const auto subresource_count = image_state.subresource_encoder.SubresourceCount();
+    auto pool_it = image_layout_map_pool_.find(subresource_count);
+    if (pool_it != image_layout_map_pool_.end() && !pool_it->second.empty()) {
+        std::shared_ptr<CommandBufferImageLayoutMap> image_layout_map = std::move(pool_it->second.back());
+        pool_it->second.pop_back();
+        image_layout_map->Reuse(image_state.GetId());
+        return image_layout_map;
+    }
+    return std::make_shared<CommandBufferImageLayoutMap>(subresource_count, image_state.GetId());
+}
+
+// Called on reset, after aliased_image_layout_map has been cleared. The pool is rebuilt from the maps used by
+// the recording being reset, which bounds it by the size of the last recording rather than letting it grow.
+void CommandBuffer::RecycleImageLayoutMaps() {
+    for (auto &pool_entry : image_layout_map_pool_) {
+        pool_entry.second.clear();
+    }
+    for (auto &[image, image_layout_map] : image_layout_registry) {
+        // Maps shared between aliased images or still referenced elsewhere can't be handed out again
+        if (!image_layout_map || image_layout_map.use_count() != 1 || !image_layout_map->UsesSmallMap()) {
+            continue;
+        }
+        const auto subresource_count = image_layout_map->GetSmallMap().get_limit();
+        image_layout_map_pool_[subresource_count].emplace_back(std::move(image_layout_map));
+    }
+}
+
 void CommandBuffer::RecordBeginQuery(const QueryObject &query_obj, const Location &loc) {
     active_queries.insert(query_obj);
     started_queries.insert(query_obj);
 
-    updated_queries.insert(query_obj);
+    updated_queries[query_obj.pool].insert(query_obj.slot);
     if (query_obj.inside_render_pass) {
         render_pass_queries.insert(query_obj);
     }
@@ -440,7 +468,7 @@ void CommandBuffer::RecordBeginQuery(const QueryObject &query_obj, const Locatio
 
 void CommandBuffer::RecordEndQuery(const QueryObject &query_obj, const Location &loc) {
     active_queries.erase(query_obj);
-    updated_queries.insert(query_obj);
+    updated_queries[query_obj.pool].insert(query_obj.slot);
     if (query_obj.inside_render_pass) {
         render_pass_queries.erase(query_obj);
     }
@@ -451,23 +479,24 @@ void CommandBuffer::RecordEndQuery(const QueryObject &query_obj, const Location
 }
 
 bool CommandBuffer::UpdatesQuery(const QueryObject &query_obj) const {
-    // Clear out the perf_pass from the caller because it isn't known when the command buffer is recorded.
-    auto key = query_obj;
-    key.perf_pass = 0;
+    // The perf_pass from the caller is ignored because it isn't known when the command buffer is recorded.
+    auto updates_query = [&query_obj](const CommandBuffer &cb) {
+        auto it = cb.updated_queries.find(query_obj.pool);
+        return it != cb.updated_queries.end() && it->second.contains(query_obj.slot);
+    };
     for (auto *sub_cb : linked_command_buffers) {
-        if (sub_cb->updated_queries.find(key) != sub_cb->updated_queries.end()) {
+        if (updates_query(*sub_cb)) {
             return true;
         }
     }
-    return updated_queries.find(key) != updated_queries.end();
+    return updates_query(*this);
 }
 
 void CommandBuffer::RecordEndQueries(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     for (uint32_t slot = firstQuery; slot < (firstQuery + queryCount); slot++) {
-        QueryObject query_obj = {queryPool, slot};
-        active_queries.erase(query_obj);
-        updated_queries.insert(query_obj);
+        active_queries.erase(QueryObject(queryPool, slot));
     }
+    updated_queries[queryPool].insert(vvl::range<uint32_t>(firstQuery, firstQuery + queryCount));
 
     for (auto &item : sub_states_) {
         item.second->RecordEndQueries(queryPool, firstQuery, queryCount);
@@ -492,7 +521,7 @@ void CommandBuffer::RecordWriteTimestamp(VkQueryPool queryPool, uint32_t slot, c
 
     // Acts like an end query
     active_queries.erase(query_obj);
-    updated_queries.insert(query_obj);
+    updated_queries[queryPool].insert(slot);
     if (query_obj.inside_render_pass) {
         render_pass_queries.erase(query_obj);
     }
@@ -510,10 +539,7 @@ void CommandBuffer::RecordResetQueryPool(VkQueryPool queryPool, uint32_t firstQu
         AddChild(pool_state);
     }
 
-    for (uint32_t slot = firstQuery; slot < (firstQuery + queryCount); slot++) {
-        QueryObject query_obj = {queryPool, slot};
-        updated_queries.insert(query_obj);
-    }
+    updated_queries[queryPool].insert(vvl::range<uint32_t>(firstQuery, firstQuery + queryCount));
 
     const bool is_perf_query = pool_state->create_info.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR;
     for (auto &item : sub_states_) {
@@ -560,10 +586,9 @@ void CommandBuffer::RecordWriteAccelerationStructuresProperties(VkQueryPool quer
 
     // Same idea as RecordEndQueries
     for (uint32_t slot = firstQuery; slot < (firstQuery + accelerationStructureCount); slot++) {
-        QueryObject query_obj = {queryPool, slot};
-        active_queries.erase(query_obj);
-        updated_queries.insert(query_obj);
+        active_queries.erase(QueryObject(queryPool, slot));
     }
+    updated_queries[queryPool].insert(vvl::range<uint32_t>(firstQuery, firstQuery + accelerationStructureCount));
 }
 
 void CommandBuffer::UpdateSubpassAttachments() {
@@ -996,9 +1021,8 @@ void vvl::CommandBuffer::RecordVideoInlineQueries(const VkVideoInlineQueryInfoKH
         item.second->RecordVideoInlineQueries(query_info);
     }
 
-    for (uint32_t i = 0; i < query_info.queryCount; i++) {
-        updated_queries.insert(QueryObject(query_info.queryPool, query_info.firstQuery + i));
-    }
+    updated_queries[query_info.queryPool].insert(
+        vvl::range<uint32_t>(query_info.firstQuery, query_info.firstQuery + query_info.queryCount));
 }
 
 void CommandBuffer::RecordDecodeVideo(const VkVideoDecodeInfoKHR &decode_info, const Location &loc) {
@@ -19,6 +19,7 @@
  */
 #pragma once
 #include "state_tracker/state_object.h"
+#include "containers/range_set.h"
 #include "state_tracker/image_layout_map.h"
 #include "state_tracker/pipeline_sub_state.h"
 #include "state_tracker/video_session_state.h"
@@ -463,7 +464,9 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     std::vector<VkEvent> events;
     vvl::unordered_set<QueryObject> active_queries;
     vvl::unordered_set<QueryObject> started_queries;
-    vvl::unordered_set<QueryObject> updated_queries;
+    // Query slots written (begun, ended, reset, ...) by this command buffer, kept as ranges per pool so that ranged
+    // commands cost one entry regardless of the query count
+    vvl::unordered_map<VkQueryPool, vvl::range_set<uint32_t>> updated_queries;
     vvl::unordered_set<QueryObject> render_pass_queries;
     ImageLayoutRegistry image_layout_registry;
     AliasedLayoutMap aliased_image_layout_map;  // storage for potentially aliased images
@@ -706,6 +709,14 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
   private:
     void ResetCBState();
 
+    // Image layout maps are allocated for every image a recording touches. Keep the ones from the previous
+    // recording around, so steady state re-recording of the same work does not go back to the heap for them.
+    std::shared_ptr<CommandBufferImageLayoutMap> NewImageLayoutMap(const vvl::Image &image_state);
+    void RecycleImageLayoutMaps();
+    // Only maps using the dense small map are pooled, keyed by their subresource count
+    vvl::unordered_map<subresource_adapter::IndexType, std::vector<std::shared_ptr<CommandBufferImageLayoutMap>>>
+        image_layout_map_pool_;
+
     // Keep track of how many CmdBeginDebugUtilsLabelEXT calls have been made without a matching CmdEndDebugUtilsLabelEXT.
     // Negative value for a secondary command buffer indicates invalid state.
     // Negative value for a primary command buffer is allowed. Validation is done at submit time accross all command buffers.
@@ -185,11 +185,66 @@ void vvl::BindableSparseMemoryTracker::BindMemory(StateObject *parent, std::shar
     auto guard = WriteLockGuard{binding_lock_};
 
     // Since we don't know which ranges will be removed, we need to unbind everything and rebind later
+    UnlinkMemory(parent);
+    binding_map_.overwrite_range(item);
+    LinkMemory(parent);
+}
+
+void vvl::BindableSparseMemoryTracker::BindMemoryRanges(StateObject *parent, std::vector<MemoryBind> &binds) {
+    if (binds.empty()) {
+        return;
+    }
+    // Binds usually arrive as disjoint pages. Applying those in resource offset order lets each insertion continue from
+    // where the previous one ended, making the batch a single merge pass over the binding map. Where binds overlap the
+    // later one wins, so those batches keep their submission order.
+    auto by_resource_offset = [](const MemoryBind &a, const MemoryBind &b) { return a.resource_offset < b.resource_offset; };
+    std::vector<MemoryBind> sorted_binds;
+    const std::vector<MemoryBind> *ordered_binds = &binds;
+    if (!std::is_sorted(binds.begin(), binds.end(), by_resource_offset)) {
+        sorted_binds = binds;
+        std::stable_sort(sorted_binds.begin(), sorted_binds.end(), by_resource_offset);
+        ordered_binds = &sorted_binds;
+    }
+    bool disjoint = true;
+    for (size_t i = 1; i < ordered_binds->size() && disjoint; ++i) {
+        const MemoryBind &prev = (*ordered_binds)[i - 1];
+        disjoint = prev.resource_offset + prev.size <= (*ordered_binds)[i].resource_offset;
+    }
+
+    auto guard = WriteLockGuard{binding_lock_};
+    UnlinkMemory(parent);
+    if (disjoint) {
+        const MemoryBind &first = ordered_binds->front();
+        auto lower = binding_map_.lower_bound(MemoryRange(first.resource_offset, first.resource_offset + first.size));
+        for (const MemoryBind &bind : *ordered_binds) {
+            const MemoryRange range(bind.resource_offset, bind.resource_offset + bind.size);
+            if (!range.non_empty()) {
+                continue;
+            }
+            // The previous bind ended at or before this one, so its lower bound is just a short walk forward
+            while (lower != binding_map_.end() && lower->first.strictly_less(range.begin)) {
+                ++lower;
+            }
+            MemoryBinding memory_data{bind.memory_state, bind.memory_offset, bind.resource_offset};
+            lower = binding_map_.overwrite_range(lower, BindingMap::value_type{range, memory_data});
+        }
+    } else {
+        for (const MemoryBind &bind : binds) {
+            MemoryBinding memory_data{bind.memory_state, bind.memory_offset, bind.resource_offset};
+            binding_map_.overwrite_range(
+                BindingMap::value_type{{bind.resource_offset, bind.resource_offset + bind.size}, memory_data});
+        }
+    }
+    LinkMemory(parent);
+}
+
+void vvl::BindableSparseMemoryTracker::UnlinkMemory(StateObject *parent) {
     for (auto &value_pair : binding_map_) {
         if (value_pair.second.memory_state) value_pair.second.memory_state->RemoveParent(parent);
     }
-    binding_map_.overwrite_range(item);
+}
 
+void vvl::BindableSparseMemoryTracker::LinkMemory(StateObject *parent) {
     for (auto &value_pair : binding_map_) {
         if (value_pair.second.memory_state) value_pair.second.memory_state->AddParent(parent);
     }
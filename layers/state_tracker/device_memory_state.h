@@ -110,6 +110,14 @@ class BindableMemoryTracker {
     using BoundRanges = vvl::unordered_map<VkDeviceMemory, std::vector<std::pair<MemoryRange, BufferRange>>>;
     using DeviceMemoryState = unordered_set<std::shared_ptr<vvl::DeviceMemory>>;
 
+    // A single (sparse) bind operation, as passed to BindMemory()
+    struct MemoryBind {
+        std::shared_ptr<vvl::DeviceMemory> memory_state;
+        VkDeviceSize memory_offset;
+        VkDeviceSize resource_offset;
+        VkDeviceSize size;
+    };
+
     virtual ~BindableMemoryTracker() {}
     // kept for backwards compatibility, only useful with the Linear tracker
     virtual const MemoryBinding *Binding() const = 0;
@@ -117,6 +125,12 @@ class BindableMemoryTracker {
     virtual bool HasFullRangeBound() const = 0;
 
     virtual void BindMemory(StateObject *, std::shared_ptr<vvl::DeviceMemory> &, VkDeviceSize, VkDeviceSize, VkDeviceSize) = 0;
+    // Applies the binds in order, as if BindMemory() was called for each of them
+    virtual void BindMemoryRanges(StateObject *parent, std::vector<MemoryBind> &binds) {
+        for (MemoryBind &bind : binds) {
+            BindMemory(parent, bind.memory_state, bind.memory_offset, bind.resource_offset, bind.size);
+        }
+    }
 
     virtual BoundMemoryRange GetBoundMemoryRange(const MemoryRange &) const = 0;
     virtual BoundRanges GetBoundRanges(const BufferRange &ranges_bounds, const std::vector<BufferRange> &ranges) const = 0;
@@ -182,6 +196,9 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &memory_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    // Applies a whole batch of binds (e.g. all binds of one VkSparseBufferMemoryBindInfo) under a single lock and with a
+    // single pass over the parent links of the bound memory
+    void BindMemoryRanges(StateObject *parent, std::vector<MemoryBind> &binds) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
     // With a list of (VALID) buffer ranges as input, and `ranges_bounds` being a range that contains all of those buffer ranges,
@@ -197,6 +214,9 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
   private:
     // This range map uses the range in resource space to know the size of the bound memory
     using BindingMap = sparse_container::range_map<VkDeviceSize, MemoryBinding>;
+    void UnlinkMemory(StateObject *parent);
+    void LinkMemory(StateObject *parent);
+
     BindingMap binding_map_;
     mutable std::shared_mutex binding_lock_;
     VkDeviceSize resource_size_;
@@ -302,6 +322,9 @@ class Bindable : public StateObject {
                     const VkDeviceSize resource_offset, const VkDeviceSize mem_size) {
         memory_tracker_->BindMemory(parent, mem, memory_offset, resource_offset, mem_size);
     }
+    void BindMemoryRanges(StateObject *parent, std::vector<BindableMemoryTracker::MemoryBind> &binds) {
+        memory_tracker_->BindMemoryRanges(parent, binds);
+    }
 
     bool HasFullRangeBound() const { return memory_tracker_->HasFullRangeBound(); }
 
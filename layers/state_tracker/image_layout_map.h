@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <functional>
 
 #include "containers/custom_containers.h"
@@ -27,9 +28,14 @@
 
 constexpr VkImageLayout kInvalidLayout = VK_IMAGE_LAYOUT_MAX_ENUM;
 
+// Images with at most this many subresources (mips * layers * aspects) track their layouts in a dense array indexed by
+// subresource instead of a node based range map. This covers single mip/layer images as well as typical mipmapped
+// textures, cube maps and small arrays. Must fit the 8-bit index of small_range_map.
+constexpr subresource_adapter::IndexType kSmallImageLayoutMapLimit = 64;
+
 // Stores the image layout of each subresource of a single image.
 // It is used to track the actual current layout (as opposed to record time tracking)
-using ImageLayoutMap = subresource_adapter::BothRangeMap<VkImageLayout, 16>;
+using ImageLayoutMap = subresource_adapter::BothRangeMap<VkImageLayout, kSmallImageLayoutMapLimit>;
 
 // Image layout state during command buffer recording
 struct ImageLayoutState {
@@ -48,11 +54,29 @@ struct ImageLayoutState {
 
 // Tracks image layout state of each subresource of a single image during record time.
 // Each command buffer has ImageLayoutRegistery that tracks all images.
-class CommandBufferImageLayoutMap : public subresource_adapter::BothRangeMap<ImageLayoutState, 16> {
+class CommandBufferImageLayoutMap : public subresource_adapter::BothRangeMap<ImageLayoutState, kSmallImageLayoutMapLimit> {
   public:
     CommandBufferImageLayoutMap(subresource_adapter::IndexType subresource_count, uint32_t image_id)
-        : subresource_adapter::BothRangeMap<ImageLayoutState, 16>(subresource_count), image_id(image_id) {}
-    const uint32_t image_id;
+        : subresource_adapter::BothRangeMap<ImageLayoutState, kSmallImageLayoutMapLimit>(subresource_count), image_id(image_id) {}
+
+    // Used by the command buffer to recycle a map across resets for another image with the same subresource count
+    void Reuse(uint32_t new_image_id) {
+        clear();
+        image_id = new_image_id;
+        validated_layout_version = 0;
+        layouts_round_trip.store(RoundTrip::kUnknown);
+    }
+
+    uint32_t image_id;
+
+    // Submit time validation cache. Holds the vvl::Image::layout_map version this map's first layouts were last
+    // found valid against (0 if none), so resubmitting against unchanged global layouts can skip the image.
+    std::atomic<uint64_t> validated_layout_version{0};
+    // Whether every subresource's current layout is a valid first layout for the next submission, so that applying
+    // this map to the global layouts keeps the cached validation result. Computed at the first submit, which can race
+    // with the command buffer being reset on another thread, hence atomic.
+    enum class RoundTrip : uint8_t { kUnknown, kNo, kYes };
+    std::atomic<RoundTrip> layouts_round_trip{RoundTrip::kUnknown};
 };
 using ImageLayoutRegistry = vvl::unordered_map<VkImage, std::shared_ptr<CommandBufferImageLayoutMap>>;
 
@@ -423,6 +423,13 @@ VkImageSubresourceRange Image::GetSubresourceEncoderRange(const DeviceState &dev
     return encoder_range;
 }
 
+// Layout map versions come from a single counter, so that a version value is never reused by another map
+// (0 is never handed out and means "not validated")
+static uint64_t NextLayoutMapVersion() {
+    static std::atomic<uint64_t> version_counter{0};
+    return ++version_counter;
+}
+
 void Image::SetInitialLayoutMap() {
     if (layout_map) {
         return;
@@ -430,10 +437,12 @@ void Image::SetInitialLayoutMap() {
 
     std::shared_ptr<ImageLayoutMap> new_layout_map;
     std::shared_ptr<std::shared_mutex> new_layout_map_lock;
+    std::shared_ptr<std::atomic<uint64_t>> new_layout_map_version;
 
-    auto get_layout_map = [&new_layout_map, &new_layout_map_lock](const Image &other_image) {
+    auto get_layout_map = [&new_layout_map, &new_layout_map_lock, &new_layout_map_version](const Image &other_image) {
         new_layout_map = other_image.layout_map;
         new_layout_map_lock = other_image.layout_map_lock;
+        new_layout_map_version = other_image.layout_map_version;
         return true;
     };
 
@@ -450,6 +459,7 @@ void Image::SetInitialLayoutMap() {
     if (!new_layout_map) {
         new_layout_map = std::make_shared<ImageLayoutMap>(subresource_encoder.SubresourceCount());
         new_layout_map_lock = std::make_shared<std::shared_mutex>();
+        new_layout_map_version = std::make_shared<std::atomic<uint64_t>>(NextLayoutMapVersion());
 
         for (auto range_gen = RangeGenerator(subresource_encoder); range_gen->non_empty(); ++range_gen) {
             new_layout_map->insert(new_layout_map->end(), std::make_pair(*range_gen, create_info.initialLayout));
@@ -457,8 +467,11 @@ void Image::SetInitialLayoutMap() {
     }
     layout_map = std::move(new_layout_map);
     layout_map_lock = std::move(new_layout_map_lock);
+    layout_map_version = std::move(new_layout_map_version);
 }
 
+void Image::BumpLayoutMapVersion() { layout_map_version->store(NextLayoutMapVersion()); }
+
 void Image::SetImageLayout(const VkImageSubresourceRange &range, VkImageLayout layout) {
     using sparse_container::update_range_value;
     using sparse_container::value_precedence;
@@ -467,6 +480,7 @@ void Image::SetImageLayout(const VkImageSubresourceRange &range, VkImageLayout l
     for (; range_gen->non_empty(); ++range_gen) {
         update_range_value(*layout_map, *range_gen, layout, value_precedence::prefer_source);
     }
+    BumpLayoutMapVersion();
 }
 
 void Image::SetSwapchain(std::shared_ptr<vvl::Swapchain> &swapchain, uint32_t swapchain_index) {
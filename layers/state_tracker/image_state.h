@@ -111,6 +111,11 @@ class Image : public Bindable, public SubStateManager<ImageSubState> {
     std::shared_ptr<std::shared_mutex> layout_map_lock;
     ReadLockGuard LayoutMapReadLock() const { return ReadLockGuard(*layout_map_lock); }
     WriteLockGuard LayoutMapWriteLock() { return WriteLockGuard(*layout_map_lock); }
+    // Version of layout_map, shared with it between aliased images. Versions are unique across all layout maps,
+    // so a version identifies both the map and its contents. Read or bump it with the layout map lock held.
+    std::shared_ptr<std::atomic<uint64_t>> layout_map_version;
+    uint64_t LayoutMapVersion() const { return layout_map_version->load(); }
+    void BumpLayoutMapVersion();
 
     vvl::unordered_set<std::shared_ptr<const vvl::VideoProfileDesc>> supported_video_profiles;
 
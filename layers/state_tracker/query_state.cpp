@@ -24,6 +24,25 @@
 
 namespace vvl {
 
+static constexpr size_t kBitsPerWord = 64;
+
+// Calls func(word, mask) for each word of a bit plane covered by the bit range [begin, end), stopping early if func
+// returns false. Returns false if it stopped early.
+template <typename Func>
+static bool ForEachWordMask(size_t begin, size_t end, Func &&func) {
+    while (begin < end) {
+        const size_t word = begin / kBitsPerWord;
+        const size_t word_end = std::min(end, (word + 1) * kBitsPerWord);
+        const size_t bit_count = word_end - begin;
+        const uint64_t bits = (bit_count == kBitsPerWord) ? ~uint64_t(0) : ((uint64_t(1) << bit_count) - 1);
+        if (!func(word, bits << (begin % kBitsPerWord))) {
+            return false;
+        }
+        begin = word_end;
+    }
+    return true;
+}
+
 QueryPool::QueryPool(VkQueryPool handle, const VkQueryPoolCreateInfo *pCreateInfo, uint32_t index_count,
                      uint32_t perf_queue_family_index, uint32_t n_perf_pass, bool has_cb, bool has_rb,
                      std::shared_ptr<const vvl::VideoProfileDesc> &&supp_video_profile,
@@ -38,39 +57,84 @@ QueryPool::QueryPool(VkQueryPool handle, const VkQueryPoolCreateInfo *pCreateInf
       perf_counter_queue_family_index(perf_queue_family_index),
       supported_video_profile(std::move(supp_video_profile)),
       video_encode_feedback_flags(enabled_video_encode_feedback_flags),
-      query_states_(pCreateInfo->queryCount) {
+      query_count_(pCreateInfo->queryCount),
+      pass_count_(n_perf_pass > 0 ? n_perf_pass : 1) {
+    const size_t word_count = (size_t(query_count_) * pass_count_ + kBitsPerWord - 1) / kBitsPerWord;
+    for (auto &plane : state_planes_) {
+        plane.resize(word_count, 0);
+    }
     const QueryState initial_state =
         (pCreateInfo->flags & VK_QUERY_POOL_CREATE_RESET_BIT_KHR) ? QUERYSTATE_RESET : QUERYSTATE_UNKNOWN;
-    for (uint32_t i = 0; i < pCreateInfo->queryCount; ++i) {
-        auto perf_size = n_perf_pass > 0 ? n_perf_pass : 1;
-        query_states_[i].reserve(perf_size);
-        for (uint32_t p = 0; p < perf_size; p++) {
-            query_states_[i].emplace_back(initial_state);
-        }
+    WriteQueryStates(0, size_t(query_count_) * pass_count_, initial_state);
+}
+
+void QueryPool::WriteQueryStates(size_t begin, size_t end, QueryState state) {
+    for (uint32_t bit = 0; bit < kQueryStateBits; ++bit) {
+        auto &plane = state_planes_[bit];
+        const bool set = (state >> bit) & 1u;
+        ForEachWordMask(begin, end, [&plane, set](size_t word, uint64_t mask) {
+            plane[word] = set ? (plane[word] | mask) : (plane[word] & ~mask);
+            return true;
+        });
     }
 }
 
-void QueryPool::SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) {
+void QueryPool::SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) { SetQueryStates(query, 1, perf_pass, state); }
+
+void QueryPool::SetQueryStates(uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state) {
     auto guard = WriteLock();
-    assert(query < query_states_.size());
-    assert((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes));
+    assert(first_query + query_count <= query_count_);
+    assert(IsValidPerfPass(perf_pass));
     if (state == QUERYSTATE_RESET) {
-        for (auto &state : query_states_[query]) {
-            state = QUERYSTATE_RESET;
+        if (first_query == 0 && query_count == query_count_) {
+            WriteQueryStates(0, size_t(query_count_) * pass_count_, state);
+        } else {
+            for (uint32_t pass = 0; pass < pass_count_; ++pass) {
+                const size_t begin = size_t(pass) * query_count_ + first_query;
+                WriteQueryStates(begin, begin + query_count, state);
+            }
         }
     } else {
-        query_states_[query][perf_pass] = state;
+        const size_t begin = size_t(perf_pass) * query_count_ + first_query;
+        WriteQueryStates(begin, begin + query_count, state);
     }
 }
+
 QueryState QueryPool::GetQueryState(uint32_t query, uint32_t perf_pass) const {
     auto guard = ReadLock();
     // this method can get called with invalid arguments during validation
-    if (query < query_states_.size() && ((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes))) {
-        return query_states_[query][perf_pass];
+    if (query < query_count_ && IsValidPerfPass(perf_pass)) {
+        const size_t index = size_t(perf_pass) * query_count_ + query;
+        const size_t word = index / kBitsPerWord;
+        const uint32_t shift = index % kBitsPerWord;
+        uint32_t state = 0;
+        for (uint32_t bit = 0; bit < kQueryStateBits; ++bit) {
+            state |= static_cast<uint32_t>((state_planes_[bit][word] >> shift) & 1u) << bit;
+        }
+        return static_cast<QueryState>(state);
     }
     return QUERYSTATE_UNKNOWN;
 }
 
+bool QueryPool::HasQueryStates(uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state) const {
+    auto guard = ReadLock();
+    if (first_query + query_count > query_count_ || !IsValidPerfPass(perf_pass)) {
+        return false;
+    }
+    const size_t begin = size_t(perf_pass) * query_count_ + first_query;
+    for (uint32_t bit = 0; bit < kQueryStateBits; ++bit) {
+        const auto &plane = state_planes_[bit];
+        const uint64_t expected = ((state >> bit) & 1u) ? ~uint64_t(0) : 0;
+        const bool matches = ForEachWordMask(begin, begin + query_count, [&plane, expected](size_t word, uint64_t mask) {
+            return ((plane[word] ^ expected) & mask) == 0;
+        });
+        if (!matches) {
+            return false;
+        }
+    }
+    return true;
+}
+
 QueryResultType QueryPool::GetQueryResultType(QueryState state, VkQueryResultFlags flags) {
     switch (state) {
         case QUERYSTATE_UNKNOWN:
@@ -19,7 +19,7 @@
  */
 #pragma once
 #include "state_tracker/state_object.h"
-#include "containers/small_vector.h"
+#include <array>
 #include <vulkan/utility/vk_safe_struct.hpp>
 
 enum QueryState {
@@ -52,7 +52,11 @@ class QueryPool : public StateObject {
     VkQueryPool VkHandle() const { return handle_.Cast<VkQueryPool>(); }
 
     void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state);
+    // Ranged update of [first_query, first_query + query_count), setting QUERYSTATE_RESET applies to every perf pass
+    void SetQueryStates(uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state);
     QueryState GetQueryState(uint32_t query, uint32_t perf_pass) const;
+    // True if every query in [first_query, first_query + query_count) is in |state| for the given perf pass
+    bool HasQueryStates(uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state) const;
     QueryResultType GetQueryResultType(QueryState state, VkQueryResultFlags flags);
 
     const vku::safe_VkQueryPoolCreateInfo safe_create_info;
@@ -71,7 +75,18 @@ class QueryPool : public StateObject {
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
-    std::vector<small_vector<QueryState, 1, uint32_t>> query_states_;
+    bool IsValidPerfPass(uint32_t perf_pass) const {
+        return (n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes);
+    }
+    void WriteQueryStates(size_t begin, size_t end, QueryState state);
+
+    // Query states are stored as bit planes, one bit per (perf pass, query) slot with the slots of each pass laid out
+    // contiguously. Ranged resets and checks then touch a single word per 64 queries.
+    static constexpr uint32_t kQueryStateBits = 3;
+    static_assert(QUERYSTATE_AVAILABLE < (1u << kQueryStateBits));
+    const uint32_t query_count_;
+    const uint32_t pass_count_;
+    std::array<std::vector<uint64_t>, kQueryStateBits> state_planes_;
     mutable std::shared_mutex lock_;
 };
 }  // namespace vvl
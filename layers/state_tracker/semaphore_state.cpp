@@ -381,7 +381,7 @@ void vvl::Semaphore::RetireWait(vvl::Queue *current_queue, uint64_t payload, con
                 // GetSemaphoreCounterValue for external semaphore might not have a registered timepoint.
                 // Add timepoint so we can retire timeline up to that point.
                 assert(type == VK_SEMAPHORE_TYPE_TIMELINE);
-                auto payload_it = timeline_.insert({payload, TimePoint{}}).first;
+                auto payload_it = timeline_.try_emplace(payload).first;
 
                 // Search existing signal. If found, notify corresponding submission.
                 // (external payload, which is already reached by the gpu, is larger then found signal,
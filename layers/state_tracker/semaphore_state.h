@@ -19,6 +19,8 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "state_tracker/submission_reference.h"
+#include <algorithm>
+#include <deque>
 #include <future>
 #include <optional>
 #include <map>
@@ -170,6 +172,67 @@ class Semaphore : public RefcountedStateObject {
     // (validation object has to use {Begin/End}BlockingOperation() when waiting for the timepoint)
     void WaitTimePoint(std::shared_future<void> &&waiter, uint64_t payload, bool unblock_validation_object, const Location &loc);
 
+    // Pending timepoints ordered by payload, with the subset of the std::map interface the semaphore needs.
+    // Payloads nearly always arrive in increasing order and retire from the front, so a sorted deque is used instead
+    // of a tree: appending past the highest payload and retiring the lowest ones are O(1) and lookups are a binary
+    // search. Only an out of order payload pays for an insertion in the middle.
+    class Timeline {
+      public:
+        using key_type = uint64_t;
+        using mapped_type = TimePoint;
+        using value_type = std::pair<uint64_t, TimePoint>;
+        using container_type = std::deque<value_type>;
+        using iterator = container_type::iterator;
+        using const_iterator = container_type::const_iterator;
+        using reverse_iterator = container_type::reverse_iterator;
+        using const_reverse_iterator = container_type::const_reverse_iterator;
+
+        bool empty() const { return points_.empty(); }
+        iterator begin() { return points_.begin(); }
+        iterator end() { return points_.end(); }
+        const_iterator begin() const { return points_.begin(); }
+        const_iterator end() const { return points_.end(); }
+        const_iterator cend() const { return points_.cend(); }
+        reverse_iterator rbegin() { return points_.rbegin(); }
+        reverse_iterator rend() { return points_.rend(); }
+        const_reverse_iterator rbegin() const { return points_.rbegin(); }
+        const_reverse_iterator rend() const { return points_.rend(); }
+
+        iterator find(uint64_t payload) {
+            auto it = LowerBound(points_, payload);
+            return (it != points_.end() && it->first == payload) ? it : points_.end();
+        }
+        const_iterator find(uint64_t payload) const {
+            auto it = LowerBound(points_, payload);
+            return (it != points_.end() && it->first == payload) ? it : points_.end();
+        }
+
+        std::pair<iterator, bool> try_emplace(uint64_t payload) {
+            if (points_.empty() || points_.back().first < payload) {
+                points_.emplace_back(std::piecewise_construct, std::forward_as_tuple(payload), std::forward_as_tuple());
+                return {std::prev(points_.end()), true};
+            }
+            auto it = LowerBound(points_, payload);
+            if (it->first == payload) {
+                return {it, false};
+            }
+            return {points_.emplace(it, std::piecewise_construct, std::forward_as_tuple(payload), std::forward_as_tuple()),
+                    true};
+        }
+        TimePoint &operator[](uint64_t payload) { return try_emplace(payload).first->second; }
+
+        void erase(iterator first, iterator last) { points_.erase(first, last); }
+
+      private:
+        template <typename Points>
+        static auto LowerBound(Points &points, uint64_t payload) {
+            return std::lower_bound(points.begin(), points.end(), payload,
+                                    [](const value_type &point, uint64_t value) { return point.first < value; });
+        }
+
+        container_type points_;
+    };
+
   private:
     enum Scope scope_ { kInternal };
     std::optional<VkExternalSemaphoreHandleTypeFlagBits> imported_handle_type_;  // has value when scope is not kInternal
@@ -183,7 +246,7 @@ class Semaphore : public RefcountedStateObject {
     // Set of pending operations ordered by payload.
     // Timeline operations can be added in any order and multiple wait operations
     // can use the same payload value.
-    std::map<uint64_t, TimePoint> timeline_;
+    Timeline timeline_;
     mutable std::shared_mutex lock_;
     DeviceState &dev_data_;
 
@@ -15,6 +15,7 @@
 
 #include "state_tracker/shader_module.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <queue>
@@ -962,29 +963,11 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
         instructions.shrink_to_fit();
     }
 
-    // These have their own object class, but need entire module parsed first
-    std::vector<const Instruction*> entry_point_instructions;
-    std::vector<const Instruction*> type_struct_instructions;
-    std::vector<const Instruction*> image_instructions;
-    std::vector<const Instruction*> func_call_instructions;
     // both OpDecorate and OpMemberDecorate builtin instructions
     std::vector<const Instruction*> builtin_decoration_instructions;
 
-    DebugNameMap debug_name_map;
-
-    std::vector<uint32_t> store_pointer_ids;
-    std::vector<uint32_t> load_pointer_ids;
-    std::vector<uint32_t> atomic_store_pointer_ids;
-    std::vector<uint32_t> atomic_load_pointer_ids;
-
-    AccessChainVariableMap access_chain_map;
-
-    uint32_t last_func_id = 0;
-    // < Function ID, OpFunctionParameter Ids >
-    vvl::unordered_map<uint32_t, std::vector<uint32_t>> func_parameter_list;
-
     // Loop through once and build up the static data
-    // Also process the entry points
+    // Entry points and struct types are more expensive and are built lazily from the Module (see BuildEntryPoints)
     for (const Instruction& insn : instructions) {
         // Build definition list
         const uint32_t result_id = insn.ResultId();
@@ -1036,44 +1019,11 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
                 variable_inst.push_back(&insn);
                 break;
 
-            case spv::OpEmitStreamVertex:
-            case spv::OpEndStreamPrimitive:
-                if (stateless_data) {
-                    stateless_data->transform_feedback_stream_inst.push_back(&insn);
-                }
-                break;
-
             // Execution Mode
             case spv::OpExecutionMode:
             case spv::OpExecutionModeId: {
                 execution_modes[insn.Word(1)].Add(insn);
-
-                // Some OpExecutionModeId will have IDs after that need the entire module parsed first,
-                if (stateless_data && opcode == spv::OpExecutionModeId) {
-                    stateless_data->execution_mode_id_inst.push_back(&insn);
-                }
             } break;
-            // Listed from vkspec.html#ray-tracing-repack
-            case spv::OpTraceRayKHR:
-            case spv::OpTraceRayMotionNV:
-            case spv::OpReportIntersectionKHR:
-            case spv::OpExecuteCallableKHR:
-                if (stateless_data) {
-                    stateless_data->has_invocation_repack_instruction = true;
-                }
-                break;
-
-            case spv::OpExtInstWithForwardRefsKHR:
-                if (stateless_data) {
-                    stateless_data->has_ext_inst_with_forward_refs = true;
-                }
-                break;
-
-            // Entry points
-            case spv::OpEntryPoint: {
-                entry_point_instructions.push_back(&insn);
-                break;
-            }
 
             // Shader Tile image instructions
             case spv::OpDepthAttachmentReadEXT:
@@ -1086,6 +1036,130 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
                 has_shader_tile_image_color_read = true;
                 break;
 
+            case spv::OpImageWrite: {
+                image_write_load_id_map.emplace(&insn, insn.Word(1));
+                break;
+            }
+            case spv::OpTypeCooperativeMatrixNV:
+            case spv::OpCooperativeMatrixMulAddNV:
+            case spv::OpTypeCooperativeMatrixKHR:
+            case spv::OpCooperativeMatrixLoadKHR:
+            case spv::OpCooperativeMatrixStoreKHR:
+            case spv::OpCooperativeMatrixLengthKHR:
+            case spv::OpCooperativeMatrixMulAddKHR: {
+                cooperative_matrix_inst.push_back(&insn);
+                break;
+            }
+
+            case spv::OpTypeCooperativeVectorNV:
+            case spv::OpCooperativeVectorLoadNV:
+            case spv::OpCooperativeVectorStoreNV:
+            case spv::OpCooperativeVectorMatrixMulNV:
+            case spv::OpCooperativeVectorMatrixMulAddNV:
+            case spv::OpCooperativeVectorReduceSumAccumulateNV:
+            case spv::OpCooperativeVectorOuterProductAccumulateNV: {
+                cooperative_vector_inst.push_back(&insn);
+                break;
+            }
+            case spv::OpEmitMeshTasksEXT: {
+                emit_mesh_tasks_inst.push_back(&insn);
+                break;
+            }
+
+            case spv::OpExtInst: {
+                if (insn.Word(4) == GLSLstd450InterpolateAtSample) {
+                    uses_interpolate_at_sample = true;
+                }
+                break;
+            }
+
+            case spv::OpLine:
+            case spv::OpSource: {
+                using_legacy_debug_info = true;
+                break;
+            }
+            case spv::OpExtInstImport: {
+                if (strcmp(insn.GetAsString(2), "NonSemantic.Shader.DebugInfo.100") == 0) {
+                    shader_debug_info_set_id = insn.ResultId();
+                }
+                break;
+            }
+
+            default:
+                // We don't care about any other defs for now.
+                break;
+        }
+    }
+
+    for (const Instruction* decoration_inst : builtin_decoration_instructions) {
+        const uint32_t built_in = decoration_inst->GetBuiltIn();
+        if (built_in == spv::BuiltInLayer) {
+            has_builtin_layer = true;
+        } else if (built_in == spv::BuiltInWorkgroupSize) {
+            has_builtin_workgroup_size = true;
+            builtin_workgroup_size_id = decoration_inst->Word(1);
+        } else if (built_in == spv::BuiltInDrawIndex) {
+            has_builtin_draw_index = true;
+        }
+    }
+
+    complete = true;
+}
+
+const Module::TypeStructMap& Module::GetTypeStructMap() const {
+    return type_struct_map_.Get([this]() { return BuildTypeStructMap(); });
+}
+
+const Module::EntryPointList& Module::GetEntryPoints() const {
+    return entry_points_.Get([this]() { return BuildEntryPoints(); });
+}
+
+Module::TypeStructMap Module::BuildTypeStructMap() const {
+    TypeStructMap type_struct_map;
+    if (!static_data_.complete) return type_struct_map;
+
+    for (const Instruction& insn : GetInstructions()) {
+        if (insn.Opcode() == spv::OpFunction) {
+            break;  // all types are declared before the first function
+        } else if (insn.Opcode() == spv::OpTypeStruct) {
+            auto new_struct = std::make_shared<const TypeStructInfo>(*this, insn, type_struct_map);
+            type_struct_map[new_struct->id] = new_struct;
+        }
+    }
+    return type_struct_map;
+}
+
+Module::EntryPointList Module::BuildEntryPoints() const {
+    EntryPointList entry_points;
+    if (!static_data_.complete) return entry_points;
+
+    // These have their own object class, but need entire module parsed first
+    std::vector<const Instruction*> entry_point_instructions;
+    std::vector<const Instruction*> image_instructions;
+    std::vector<const Instruction*> func_call_instructions;
+
+    DebugNameMap debug_name_map;
+
+    std::vector<uint32_t> store_pointer_ids;
+    std::vector<uint32_t> load_pointer_ids;
+    std::vector<uint32_t> atomic_store_pointer_ids;
+    std::vector<uint32_t> atomic_load_pointer_ids;
+
+    AccessChainVariableMap access_chain_map;
+
+    uint32_t last_func_id = 0;
+    // < Function ID, OpFunctionParameter Ids >
+    vvl::unordered_map<uint32_t, std::vector<uint32_t>> func_parameter_list;
+
+    for (const Instruction& insn : GetInstructions()) {
+        const uint32_t opcode = insn.Opcode();
+        switch (opcode) {
+            // Entry points
+            case spv::OpEntryPoint: {
+                entry_point_instructions.push_back(&insn);
+                break;
+            }
+
             // Access operations
             case spv::OpImageSampleImplicitLod:
             case spv::OpImageSampleProjImplicitLod:
@@ -1113,25 +1187,15 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
             case spv::OpImageSparseFetch:
             case spv::OpImageSparseGather:
             case spv::OpFragmentFetchAMD:
-            case spv::OpFragmentMaskFetchAMD: {
+            case spv::OpFragmentMaskFetchAMD:
+            case spv::OpImageWrite: {
                 image_instructions.push_back(&insn);
                 break;
             }
-            case spv::OpImageQuerySizeLod:
-            case spv::OpImageQuerySize:
-            case spv::OpImageQueryLevels:
-            case spv::OpImageQuerySamples:
-                // from spec "return properties of the image descriptor that would be accessed. The image itself is not accessed."
-                break;
             case spv::OpStore: {
                 store_pointer_ids.emplace_back(insn.Word(1));  // object id or AccessChain id
                 break;
             }
-            case spv::OpImageWrite: {
-                image_instructions.push_back(&insn);
-                image_write_load_id_map.emplace(&insn, insn.Word(1));
-                break;
-            }
             case spv::OpLoad: {
                 load_pointer_ids.emplace_back(insn.Word(3));  // object id or AccessChain id
                 break;
@@ -1148,66 +1212,12 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
                 image_instructions.push_back(&insn);
                 break;
             }
-            case spv::OpTypeStruct: {
-                type_struct_instructions.push_back(&insn);
-                break;
-            }
-            case spv::OpReadClockKHR: {
-                if (stateless_data) {
-                    stateless_data->read_clock_inst.push_back(&insn);
-                }
-                break;
-            }
-            case spv::OpTypeCooperativeMatrixNV:
-            case spv::OpCooperativeMatrixMulAddNV:
-            case spv::OpTypeCooperativeMatrixKHR:
-            case spv::OpCooperativeMatrixLoadKHR:
-            case spv::OpCooperativeMatrixStoreKHR:
-            case spv::OpCooperativeMatrixLengthKHR:
-            case spv::OpCooperativeMatrixMulAddKHR: {
-                cooperative_matrix_inst.push_back(&insn);
-                break;
-            }
-
-            case spv::OpTypeCooperativeVectorNV:
-            case spv::OpCooperativeVectorLoadNV:
-            case spv::OpCooperativeVectorStoreNV:
-            case spv::OpCooperativeVectorMatrixMulNV:
-            case spv::OpCooperativeVectorMatrixMulAddNV:
-            case spv::OpCooperativeVectorReduceSumAccumulateNV:
-            case spv::OpCooperativeVectorOuterProductAccumulateNV: {
-                cooperative_vector_inst.push_back(&insn);
-                break;
-            }
-            case spv::OpEmitMeshTasksEXT: {
-                emit_mesh_tasks_inst.push_back(&insn);
-                break;
-            }
-
-            case spv::OpExtInst: {
-                if (insn.Word(4) == GLSLstd450InterpolateAtSample) {
-                    uses_interpolate_at_sample = true;
-                }
-                break;
-            }
 
             case spv::OpName: {
                 debug_name_map[insn.Word(1)] = &insn;
                 break;
             }
 
-            case spv::OpLine:
-            case spv::OpSource: {
-                using_legacy_debug_info = true;
-                break;
-            }
-            case spv::OpExtInstImport: {
-                if (strcmp(insn.GetAsString(2), "NonSemantic.Shader.DebugInfo.100") == 0) {
-                    shader_debug_info_set_id = insn.ResultId();
-                }
-                break;
-            }
-
             // Build up Function mappings
             case spv::OpFunction:
                 last_func_id = insn.ResultId();
@@ -1222,21 +1232,12 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
 
             default:
                 if (AtomicOperation(opcode)) {
-                    if (stateless_data) {
-                        stateless_data->atomic_inst.push_back(&insn);
-                    }
                     if (opcode == spv::OpAtomicStore) {
                         atomic_store_pointer_ids.emplace_back(insn.Operand(0));
                     } else {
                         atomic_load_pointer_ids.emplace_back(insn.Operand(0));
                     }
                 }
-                if (GroupOperation(opcode)) {
-                    if (stateless_data) {
-                        stateless_data->group_inst.push_back(&insn);
-                    }
-                }
-                // We don't care about any other defs for now.
                 break;
         }
     }
@@ -1262,10 +1263,10 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
     // parsing, take every load/store find the variable it touches
     // (image access are done later)
     VariableAccessMap variable_access_map;
-    auto mark_variable_access = [&module_state, &variable_access_map](const std::vector<uint32_t>& ids, uint32_t access) {
+    auto mark_variable_access = [this, &variable_access_map](const std::vector<uint32_t>& ids, uint32_t access) {
         for (const auto& object_id : ids) {
             uint32_t variable_id = object_id;
-            const Instruction* insn = module_state.FindDef(object_id);
+            const Instruction* insn = FindDef(object_id);
             while (insn) {
                 switch (insn->Opcode()) {
                     case spv::OpImageTexelPointer:  // used for atomics
@@ -1273,7 +1274,7 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
                     case spv::OpInBoundsAccessChain:
                     case spv::OpCopyObject:
                         variable_id = insn->Word(3);
-                        insn = module_state.FindDef(variable_id);
+                        insn = FindDef(variable_id);
                         break;
                     case spv::OpVariable:
                         variable_access_map[variable_id] |= access;
@@ -1292,34 +1293,12 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
     mark_variable_access(atomic_store_pointer_ids, AccessBit::atomic_write);
     mark_variable_access(atomic_load_pointer_ids, AccessBit::atomic_read);
 
-    for (const Instruction* decoration_inst : builtin_decoration_instructions) {
-        const uint32_t built_in = decoration_inst->GetBuiltIn();
-        if (built_in == spv::BuiltInLayer) {
-            has_builtin_layer = true;
-        } else if (built_in == spv::BuiltInFullyCoveredEXT) {
-            if (stateless_data) {
-                stateless_data->has_builtin_fully_covered = true;
-            }
-        } else if (built_in == spv::BuiltInWorkgroupSize) {
-            has_builtin_workgroup_size = true;
-            builtin_workgroup_size_id = decoration_inst->Word(1);
-        } else if (built_in == spv::BuiltInDrawIndex) {
-            has_builtin_draw_index = true;
-        }
-    }
-
-    // Need to get struct first and EntryPoint's variables depend on it
-    for (const auto& insn : type_struct_instructions) {
-        auto new_struct = type_structs.emplace_back(std::make_shared<TypeStructInfo>(module_state, *insn));
-        type_struct_map[new_struct->id] = new_struct;
-    }
-
     // Need to get ImageAccesses as EntryPoint's variables depend on it
     std::vector<std::shared_ptr<ImageAccess>> image_accesses;
     ImageAccessMap image_access_map;
 
     for (const auto& insn : image_instructions) {
-        auto new_access = image_accesses.emplace_back(std::make_shared<ImageAccess>(module_state, *insn, func_parameter_map));
+        auto new_access = image_accesses.emplace_back(std::make_shared<ImageAccess>(*this, *insn, func_parameter_map));
         if (!new_access->variable_image_insn.empty() && new_access->valid_access) {
             for (const Instruction* image_insn : new_access->variable_image_insn) {
                 image_access_map[image_insn->ResultId()].push_back(new_access);
@@ -1327,15 +1306,138 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
         }
     }
 
-    // Need to build the definitions table for FindDef before looking for which instructions each entry point uses
     for (const auto& insn : entry_point_instructions) {
-        entry_points.emplace_back(std::make_shared<EntryPoint>(module_state, *insn, image_access_map, access_chain_map,
+        entry_points.emplace_back(std::make_shared<EntryPoint>(*this, *insn, image_access_map, access_chain_map,
                                                                variable_access_map, debug_name_map));
     }
+    return entry_points;
 }
 
-std::shared_ptr<const TypeStructInfo> Module::GetTypeStructInfo(const Instruction* insn) const {
-    while (true) {
+void Module::FillStatelessData(StatelessData& stateless_data) const {
+    for (const Instruction& insn : GetInstructions()) {
+        const uint32_t opcode = insn.Opcode();
+        switch (opcode) {
+            case spv::OpDecorate:
+            case spv::OpMemberDecorate:
+                if (insn.Word(opcode == spv::OpDecorate ? 2 : 3) == spv::DecorationBuiltIn &&
+                    insn.GetBuiltIn() == spv::BuiltInFullyCoveredEXT) {
+                    stateless_data.has_builtin_fully_covered = true;
+                }
+                break;
+
+            case spv::OpEmitStreamVertex:
+            case spv::OpEndStreamPrimitive:
+                stateless_data.transform_feedback_stream_inst.push_back(&insn);
+                break;
+
+            // Some OpExecutionModeId will have IDs after that need the entire module parsed first,
+            case spv::OpExecutionModeId:
+                stateless_data.execution_mode_id_inst.push_back(&insn);
+                break;
+
+            // Listed from vkspec.html#ray-tracing-repack
+            case spv::OpTraceRayKHR:
+            case spv::OpTraceRayMotionNV:
+            case spv::OpReportIntersectionKHR:
+            case spv::OpExecuteCallableKHR:
+                stateless_data.has_invocation_repack_instruction = true;
+                break;
+
+            case spv::OpExtInstWithForwardRefsKHR:
+                stateless_data.has_ext_inst_with_forward_refs = true;
+                break;
+
+            case spv::OpReadClockKHR:
+                stateless_data.read_clock_inst.push_back(&insn);
+                break;
+
+            default:
+                if (AtomicOperation(opcode)) {
+                    stateless_data.atomic_inst.push_back(&insn);
+                }
+                if (GroupOperation(opcode)) {
+                    stateless_data.group_inst.push_back(&insn);
+                }
+                break;
+        }
+    }
+}
+
+std::shared_ptr<Module> ModuleCache::Find(uint64_t key, size_t code_size, const uint32_t* code) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+
+    std::shared_ptr<Module> found;
+    auto& bucket = it->second;
+    for (auto entry = bucket.begin(); entry != bucket.end();) {
+        auto module = entry->lock();
+        if (!module) {
+            entry = bucket.erase(entry);
+            continue;
+        }
+        // The hash is only used to find the bucket, the words are compared to rule out collisions
+        if (!found && module->words_.size() * sizeof(uint32_t) == code_size &&
+            std::memcmp(module->words_.data(), code, code_size) == 0) {
+            found = std::move(module);
+        }
+        ++entry;
+    }
+    if (bucket.empty()) {
+        entries_.erase(it);
+    }
+    return found;
+}
+
+void ModuleCache::Insert(uint64_t key, const std::shared_ptr<Module>& module) {
+    entries_[key].emplace_back(module);
+
+    // Buckets are pruned when looked up, but binaries that are never seen again leave expired entries behind
+    if (entries_.size() >= next_sweep_size_) {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            auto& bucket = it->second;
+            bucket.erase(std::remove_if(bucket.begin(), bucket.end(), [](const auto& entry) { return entry.expired(); }),
+                         bucket.end());
+            it = bucket.empty() ? entries_.erase(it) : std::next(it);
+        }
+        next_sweep_size_ = std::max(kMinSweepSize, entries_.size() * 2);
+    }
+}
+
+std::shared_ptr<Module> ModuleCache::GetOrCreate(size_t code_size, const uint32_t* code, StatelessData* stateless_data) {
+    // Nothing worth sharing if the SPIR-V is not valid, let the Module constructor deal with it
+    if (!code || code_size < sizeof(uint32_t) || (code_size % 4) != 0 || code[0] != spv::MagicNumber) {
+        return std::make_shared<Module>(code_size, code, stateless_data);
+    }
+
+    const uint64_t key = hash_util::Hash64(code, code_size);
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (auto cached = Find(key, code_size, code)) {
+            if (stateless_data) {
+                cached->FillStatelessData(*stateless_data);
+            }
+            return cached;
+        }
+    }
+
+    // Parse outside the lock, if two threads race on the same binary both will parse, but only the first is kept
+    auto module = std::make_shared<Module>(code_size, code, stateless_data);
+    if (!module->static_data_.complete) {
+        return module;  // StaticData stopped parsing early, never share it
+    }
+
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!Find(key, code_size, code)) {
+        Insert(key, module);
+    }
+    return module;
+}
+
+// Walks through variables, pointers and arrays to find the OpTypeStruct, if there is one
+const Instruction* Module::GetTypeStructInstruction(const Instruction* insn) const {
+    while (insn) {
         if (insn->Opcode() == spv::OpVariable) {
             insn = FindDef(insn->TypeId());
         } else if (insn->Opcode() == spv::OpTypePointer) {
@@ -1343,13 +1445,22 @@ std::shared_ptr<const TypeStructInfo> Module::GetTypeStructInfo(const Instructio
         } else if (insn->IsArray()) {
             insn = FindDef(insn->Word(2));
         } else if (insn->Opcode() == spv::OpTypeStruct) {
-            // return the actual execution modes for this id, or a default empty set.
-            const auto it = static_data_.type_struct_map.find(insn->ResultId());
-            return (it != static_data_.type_struct_map.end()) ? it->second : nullptr;
+            return insn;
         } else {
             return nullptr;
         }
     }
+    return nullptr;
+}
+
+std::shared_ptr<const TypeStructInfo> Module::GetTypeStructInfo(const Instruction* insn) const {
+    const Instruction* struct_insn = GetTypeStructInstruction(insn);
+    if (!struct_insn) {
+        return nullptr;
+    }
+    const TypeStructMap& type_struct_map = GetTypeStructMap();
+    const auto it = type_struct_map.find(struct_insn->ResultId());
+    return (it != type_struct_map.end()) ? it->second : nullptr;
 }
 
 std::string Module::GetDecorations(uint32_t id) const {
@@ -1523,7 +1634,7 @@ std::string Module::DescribeInstruction(const Instruction& error_insn) const {
 
 std::shared_ptr<const EntryPoint> Module::FindEntrypoint(char const* name, VkShaderStageFlagBits stageBits) const {
     if (!name) return nullptr;
-    for (const auto& entry_point : static_data_.entry_points) {
+    for (const auto& entry_point : GetEntryPoints()) {
         if (entry_point->name.compare(name) == 0 && entry_point->stage == stageBits) {
             return entry_point;
         }
@@ -2227,14 +2338,20 @@ TaskPayloadVariable::TaskPayloadVariable(const Module& module_state, const Instr
     }
 }
 
-TypeStructInfo::TypeStructInfo(const Module& module_state, const Instruction& struct_insn)
+TypeStructInfo::TypeStructInfo(const Module& module_state, const Instruction& struct_insn,
+                               const vvl::unordered_map<uint32_t, std::shared_ptr<const TypeStructInfo>>& type_struct_map)
     : id(struct_insn.Word(1)), length(struct_insn.Length() - 2), decorations(module_state.GetDecorationSet(id)) {
     members.resize(length);
     for (uint32_t i = 0; i < length; i++) {
         Member& member = members[i];
         member.id = struct_insn.Word(2 + i);
         member.insn = module_state.FindDef(member.id);
-        member.type_struct_info = module_state.GetTypeStructInfo(member.insn);
+        if (const Instruction* member_struct_insn = module_state.GetTypeStructInstruction(member.insn)) {
+            const auto it = type_struct_map.find(member_struct_insn->ResultId());
+            if (it != type_struct_map.end()) {
+                member.type_struct_info = it->second;
+            }
+        }
 
         const auto it = decorations.member_decorations.find(i);
         if (it != decorations.member_decorations.end()) {
@@ -21,6 +21,8 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -219,7 +221,9 @@ struct TypeStructInfo {
     };
     std::vector<Member> members;
 
-    TypeStructInfo(const Module &module_state, const Instruction &struct_insn);
+    // Nested structs are always declared first, so they are looked up in the map being built
+    TypeStructInfo(const Module &module_state, const Instruction &struct_insn,
+                   const vvl::unordered_map<uint32_t, std::shared_ptr<const TypeStructInfo>> &type_struct_map);
 
     TypeStructSize GetSize(const Module &module_state) const;
 };
@@ -597,6 +601,22 @@ struct EntryPoint {
                                  const AccessChainVariableMap &access_chain_map);
 };
 
+// Holds a piece of the Module that is only computed the first time it is requested.
+// Modules are shared across threads (pipelines, shader objects, the ModuleCache) so the build is guarded by a once_flag
+template <typename T>
+class LazyAnalysis {
+  public:
+    template <typename Builder>
+    const T &Get(Builder &&builder) const {
+        std::call_once(once_, [this, &builder]() { value_ = builder(); });
+        return value_;
+    }
+
+  private:
+    mutable std::once_flag once_;
+    mutable T value_;
+};
+
 // Info to capture while parsing the SPIR-V, but will only be used by SpirvValidator::Validate and don't need to save after
 struct StatelessData {
     // Used if the Shader Module is being passed in VkPipelineShaderStageCreateInfo
@@ -680,12 +700,8 @@ struct Module {
         bool using_legacy_debug_info{false};
         uint32_t shader_debug_info_set_id = 0;  // non-zero means shader has NonSemantic.Shader.DebugInfo.100
 
-        // EntryPoint has pointer references inside it that need to be preserved
-        std::vector<std::shared_ptr<EntryPoint>> entry_points;
-
-        std::vector<std::shared_ptr<TypeStructInfo>> type_structs;  // All OpTypeStruct objects
-        // <OpTypeStruct ID, info> - used for faster lookup as there can many structs
-        vvl::unordered_map<uint32_t, std::shared_ptr<const TypeStructInfo>> type_struct_map;
+        // False if parsing stopped early (invalid SPIR-V or group decorations), the lazy analyses will then be empty
+        bool complete{false};
 
         // Tracks accesses (load, store, atomic) to the instruction calling them
         // Example: the OpLoad does the "access" but need to know if a OpImageRead uses that OpLoad later
@@ -702,6 +718,11 @@ struct Module {
 
     const StaticData static_data_;
 
+    // <OpTypeStruct ID, info> - used for faster lookup as there can many structs
+    using TypeStructMap = vvl::unordered_map<uint32_t, std::shared_ptr<const TypeStructInfo>>;
+    // EntryPoint has pointer references inside it that need to be preserved
+    using EntryPointList = std::vector<std::shared_ptr<EntryPoint>>;
+
     // Hold a handle so error message can know where the SPIR-V was from (VkShaderModule or VkShaderEXT)
     VulkanTypedHandle handle_;                            // Will be updated once its known its valid SPIR-V
     VulkanTypedHandle handle() const { return handle_; }  // matches normal convention to get handle
@@ -713,7 +734,14 @@ struct Module {
     Module(size_t codeSize, const uint32_t *pCode, StatelessData *stateless_data = nullptr)
         : valid_spirv(pCode && pCode[0] == spv::MagicNumber && ((codeSize % 4) == 0)),
           words_(pCode, pCode + codeSize / sizeof(uint32_t)),
-          static_data_(*this, stateless_data) {}
+          static_data_(*this, stateless_data) {
+        if (stateless_data && !stateless_data->has_group_decoration) {
+            FillStatelessData(*stateless_data);
+        }
+    }
+
+    // StatelessData only points into the instructions, so it can be gathered for a Module that was already parsed
+    void FillStatelessData(StatelessData &stateless_data) const;
 
     const Instruction *FindDef(uint32_t id) const {
         auto it = static_data_.definitions.find(id);
@@ -736,6 +764,11 @@ struct Module {
     }
 
     std::shared_ptr<const TypeStructInfo> GetTypeStructInfo(const Instruction *insn) const;
+    const Instruction *GetTypeStructInstruction(const Instruction *insn) const;
+
+    // The following are the expensive part of parsing and are only built the first time something asks for them
+    const TypeStructMap &GetTypeStructMap() const;
+    const EntryPointList &GetEntryPoints() const;
 
     // Used to get human readable strings for error messages
     std::string GetDecorations(uint32_t id) const;
@@ -775,6 +808,31 @@ struct Module {
         return std::any_of(static_data_.capability_list.begin(), static_data_.capability_list.end(),
                            [find_capability](const spv::Capability &capability) { return capability == find_capability; });
     }
+
+  private:
+    TypeStructMap BuildTypeStructMap() const;
+    EntryPointList BuildEntryPoints() const;
+
+    LazyAnalysis<TypeStructMap> type_struct_map_;
+    LazyAnalysis<EntryPointList> entry_points_;
+};
+
+// Content addressed cache of parsed SPIR-V, keyed by a hash of the words.
+// Used where there is no VkShaderModule handle to attach to the Module (inline VkShaderModuleCreateInfo in pipelines), which
+// is where apps tend to pass the same binary over and over. Entries are weak and never keep a Module alive.
+class ModuleCache {
+  public:
+    std::shared_ptr<Module> GetOrCreate(size_t code_size, const uint32_t *code, StatelessData *stateless_data);
+
+  private:
+    std::shared_ptr<Module> Find(uint64_t key, size_t code_size, const uint32_t *code);
+    void Insert(uint64_t key, const std::shared_ptr<Module> &module);
+
+    static constexpr size_t kMinSweepSize = 256;
+
+    std::mutex lock_;
+    vvl::unordered_map<uint64_t, std::vector<std::weak_ptr<Module>>> entries_;
+    size_t next_sweep_size_ = kMinSweepSize;
 };
 
 }  // namespace spirv
@@ -784,7 +842,10 @@ namespace vvl {
 struct ShaderModule : public StateObject {
     ShaderModule(VkShaderModule handle, std::shared_ptr<spirv::Module> &spirv_module)
         : StateObject(handle, kVulkanObjectTypeShaderModule), spirv(spirv_module) {
-        spirv->handle_ = handle_;
+        // Inline SPIR-V has no handle and the Module can be shared from the spirv::ModuleCache
+        if (handle != VK_NULL_HANDLE) {
+            spirv->handle_ = handle_;
+        }
     }
 
     // For when we need to create a module with no SPIR-V backing it
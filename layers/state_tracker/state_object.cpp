@@ -50,20 +50,50 @@ bool vvl::StateObject::AddParent(StateObject* parent_node) {
 void vvl::StateObject::RemoveParent(StateObject* parent_node) {
     assert(parent_node);
     auto guard = WriteLockTree();
-    parent_nodes_.erase(parent_node->Handle());
+    if (parent_nodes_.erase(parent_node->Handle())) {
+        ShrinkParentNodes();
+    }
 }
 
-// copy the current set of parents so that we don't need to hold the lock
+// Objects bound to many descriptor sets or command buffers can accumulate thousands of parents, and the map
+// keeps its peak capacity after they are removed again. Every InUse() and Invalidate() walk pays for that
+// capacity, so give it back once the map is mostly empty. Shrinking only at a fixed ratio keeps the rehash
+// cost amortized over the removals that caused it.
+void vvl::StateObject::ShrinkParentNodes() {
+    const size_t buckets = parent_nodes_.bucket_count();
+    if (buckets >= kParentNodesShrinkMinBuckets && parent_nodes_.size() * kParentNodesShrinkRatio <= buckets) {
+        parent_nodes_.rehash(0);
+    }
+}
+
+// Gather the current set of parents so that we don't need to hold the lock
 // while calling NotifyInvalidate on them, as that would lead to recursive locking.
-vvl::StateObject::NodeMap vvl::StateObject::GetParentsForInvalidate(bool unlink) {
-    NodeMap result;
+// The parents are locked into a flat list here, rather than copying the map, so that
+// expired parents are filtered out once and no hash table is built.
+vvl::StateObject::NodeList vvl::StateObject::GetParentsForInvalidate(bool unlink) {
+    NodeList result;
+    auto add_live_parent = [&result](const std::weak_ptr<StateObject>& weak_parent) {
+        if (auto node = weak_parent.lock()) {
+            result.emplace_back(std::move(node));
+        }
+    };
     if (unlink) {
-        auto guard = WriteLockTree();
-        result = std::move(parent_nodes_);
-        parent_nodes_.clear();
+        NodeMap parents;
+        {
+            auto guard = WriteLockTree();
+            parents = std::move(parent_nodes_);
+            parent_nodes_.clear();
+        }
+        result.reserve(static_cast<uint32_t>(parents.size()));
+        for (const auto& item : parents) {
+            add_live_parent(item.second);
+        }
     } else {
         auto guard = ReadLockTree();
-        result = parent_nodes_;
+        result.reserve(static_cast<uint32_t>(parent_nodes_.size()));
+        for (const auto& item : parent_nodes_) {
+            add_live_parent(item.second);
+        }
     }
     return result;
 }
@@ -90,9 +120,8 @@ void vvl::StateObject::NotifyInvalidate(const NodeList& invalid_nodes, bool unli
 
     NodeList up_nodes = invalid_nodes;
     up_nodes.emplace_back(shared_from_this());
-    for (auto& item : current_parents) {
-        auto node = item.second.lock();
-        if (node && !node->Destroyed()) {
+    for (auto& node : current_parents) {
+        if (!node->Destroyed()) {
             node->NotifyInvalidate(up_nodes, unlink);
         }
     }
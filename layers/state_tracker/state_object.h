@@ -111,9 +111,9 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     // Called recursively for every parent object of something that has become invalid
     virtual void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink);
 
-    // returns a copy of the current set of parents so that they can be walked
+    // returns the parents that are still alive so that they can be walked
     // without the tree lock held. If unlink == true, parent_nodes_ is also cleared.
-    NodeMap GetParentsForInvalidate(bool unlink);
+    NodeList GetParentsForInvalidate(bool unlink);
 
     // Set to true when the API-level object is destroyed, but this object may
     // hang around until its shared_ptr refcount goes to zero.
@@ -124,6 +124,12 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     ReadLockGuard ReadLockTree() const { return ReadLockGuard(tree_lock_); }
     WriteLockGuard WriteLockTree() { return WriteLockGuard(tree_lock_); }
 
+    // Drop the excess capacity of parent_nodes_ once most of its entries have been removed, so that
+    // walking it (InUse, Invalidate) stays proportional to the live bindings. Requires the tree write lock.
+    void ShrinkParentNodes();
+    static constexpr size_t kParentNodesShrinkMinBuckets = 64;
+    static constexpr size_t kParentNodesShrinkRatio = 8;
+
     // Set of immediate parent nodes for this object. For an in-use object, the
     // parent nodes should form a tree with the root being a command buffer.
     NodeMap parent_nodes_;
@@ -469,6 +469,78 @@ struct BufferAddressInfillUpdateOps {
     const Mapped &insert_value;
 };
 
+const DeviceState::BufferAddressMapStore *DeviceState::BufferAddressSnapshot::Find(VkDeviceAddress address) const {
+    // ranges are sorted and don't overlap, so the only candidate is the last one starting at or before address
+    auto it = std::upper_bound(ranges.begin(), ranges.end(), address,
+                               [](VkDeviceAddress value, const BufferAddressRange &range) { return value < range.begin; });
+    if (it == ranges.begin()) {
+        return nullptr;
+    }
+    --it;
+    if (!it->includes(address)) {
+        return nullptr;
+    }
+    return &buffers[std::distance(ranges.begin(), it)];
+}
+
+DeviceState::BufferAddressMapStore DeviceState::GetBuffersByAddress(VkDeviceAddress address) const {
+    // The reference keeps the snapshot alive while it is searched, even if it is replaced meanwhile. A thread lets go of a replaced
+    // snapshot at its next lookup that finds a newer one.
+    struct CachedSnapshot {
+        uint64_t owner = 0;
+        std::shared_ptr<const BufferAddressSnapshot> snapshot;
+    };
+    thread_local CachedSnapshot cached;
+    if (cached.owner == buffer_address_snapshot_owner_ && cached.snapshot &&
+        cached.snapshot->version == buffer_address_map_version_.load(std::memory_order_acquire)) {
+        const BufferAddressMapStore *found = cached.snapshot->Find(address);
+        return found ? *found : BufferAddressMapStore();
+    }
+
+    BufferAddressMapStore buffers;
+    bool rebuild = false;
+    {
+        ReadLockGuard guard(buffer_address_lock_);
+        // The version only changes under the write lock
+        if (buffer_address_snapshot_ && buffer_address_snapshot_->version == buffer_address_map_version_.load()) {
+            cached.owner = buffer_address_snapshot_owner_;
+            cached.snapshot = buffer_address_snapshot_;
+            const BufferAddressMapStore *found = cached.snapshot->Find(address);
+            return found ? *found : BufferAddressMapStore();
+        }
+
+        // The map changed since the snapshot was taken
+        auto found_it = buffer_address_map_.find(address);
+        if (found_it != buffer_address_map_.end()) {
+            buffers = found_it->second;
+        }
+        const size_t stale_lookups = buffer_address_stale_lookups_.fetch_add(1) + 1;
+        rebuild = stale_lookups * kBufferAddressSnapshotRebuildRatio >= buffer_address_map_.size();
+    }
+    if (rebuild) {
+        WriteLockGuard guard(buffer_address_lock_);
+        // Another thread may have beaten us to it
+        if (!buffer_address_snapshot_ || buffer_address_snapshot_->version != buffer_address_map_version_.load()) {
+            PublishBufferAddressSnapshot();
+        }
+    }
+    return buffers;
+}
+
+void DeviceState::PublishBufferAddressSnapshot() const {
+    auto snapshot = std::make_shared<BufferAddressSnapshot>();
+    snapshot->version = buffer_address_map_version_.load();
+    snapshot->ranges.reserve(buffer_address_map_.size());
+    snapshot->buffers.reserve(buffer_address_map_.size());
+    for (const auto &[address_range, buffers] : buffer_address_map_) {
+        snapshot->ranges.emplace_back(address_range);
+        snapshot->buffers.emplace_back(buffers);
+    }
+    // The replaced snapshot is freed once the threads that cached it move on to this one
+    buffer_address_snapshot_ = std::move(snapshot);
+    buffer_address_stale_lookups_.store(0);
+}
+
 std::shared_ptr<Buffer> DeviceState::CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *create_info) {
     return std::make_shared<Buffer>(*this, handle, create_info);
 }
@@ -505,6 +577,7 @@ void DeviceState::PostCallRecordCreateBuffer(VkDevice device, const VkBufferCrea
 
         BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
         sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+        buffer_address_map_version_++;
     }
 
     const VkBufferUsageFlags2 descriptor_buffer_usages =
@@ -683,6 +756,7 @@ void DeviceState::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, c
 
                 return false;
             });
+            buffer_address_map_version_++;
         }
     }
     Destroy<Buffer>(buffer);
@@ -1316,39 +1390,47 @@ void DeviceState::PreCallRecordQueueBindSparse(VkQueue queue, uint32_t bindInfoC
 
     std::vector<QueueSubmission> submissions;
     submissions.reserve(bindInfoCount);
+    std::vector<BindableMemoryTracker::MemoryBind> binds;
     for (uint32_t bind_idx = 0; bind_idx < bindInfoCount; ++bind_idx) {
         const VkBindSparseInfo &bind_info = pBindInfo[bind_idx];
-        // Track objects tied to memory
+        // Track objects tied to memory. The binds for each resource are applied as one batch.
         for (uint32_t j = 0; j < bind_info.bufferBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pBufferBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pBufferBinds[j].pBinds[k];
-                auto memory_state = Get<DeviceMemory>(sparse_binding.memory);
-                if (auto buffer_state = Get<Buffer>(bind_info.pBufferBinds[j].buffer)) {
-                    buffer_state->BindMemory(buffer_state.get(), memory_state, sparse_binding.memoryOffset,
-                                             sparse_binding.resourceOffset, sparse_binding.size);
+            const VkSparseBufferMemoryBindInfo &buffer_bind = bind_info.pBufferBinds[j];
+            if (auto buffer_state = Get<Buffer>(buffer_bind.buffer)) {
+                binds.clear();
+                for (uint32_t k = 0; k < buffer_bind.bindCount; k++) {
+                    const VkSparseMemoryBind &sparse_binding = buffer_bind.pBinds[k];
+                    binds.push_back({Get<DeviceMemory>(sparse_binding.memory), sparse_binding.memoryOffset,
+                                     sparse_binding.resourceOffset, sparse_binding.size});
                 }
+                buffer_state->BindMemoryRanges(buffer_state.get(), binds);
             }
         }
         for (uint32_t j = 0; j < bind_info.imageOpaqueBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageOpaqueBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageOpaqueBinds[j].pBinds[k];
-                auto memory_state = Get<DeviceMemory>(sparse_binding.memory);
-                if (auto image_state = Get<Image>(bind_info.pImageOpaqueBinds[j].image)) {
-                    image_state->BindMemory(image_state.get(), memory_state, sparse_binding.memoryOffset,
-                                            sparse_binding.resourceOffset, sparse_binding.size);
+            const VkSparseImageOpaqueMemoryBindInfo &image_opaque_bind = bind_info.pImageOpaqueBinds[j];
+            if (auto image_state = Get<Image>(image_opaque_bind.image)) {
+                binds.clear();
+                for (uint32_t k = 0; k < image_opaque_bind.bindCount; k++) {
+                    const VkSparseMemoryBind &sparse_binding = image_opaque_bind.pBinds[k];
+                    binds.push_back({Get<DeviceMemory>(sparse_binding.memory), sparse_binding.memoryOffset,
+                                     sparse_binding.resourceOffset, sparse_binding.size});
                 }
+                image_state->BindMemoryRanges(image_state.get(), binds);
             }
         }
         for (uint32_t j = 0; j < bind_info.imageBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageBinds[j].pBinds[k];
-                // TODO: This size is broken for non-opaque bindings, need to update to comprehend full sparse binding data
-                VkDeviceSize size = sparse_binding.extent.depth * sparse_binding.extent.height * sparse_binding.extent.width * 4;
-                VkDeviceSize offset = sparse_binding.offset.z * sparse_binding.offset.y * sparse_binding.offset.x * 4;
-                auto memory_state = Get<DeviceMemory>(sparse_binding.memory);
-                if (auto image_state = Get<Image>(bind_info.pImageBinds[j].image)) {
-                    image_state->BindMemory(image_state.get(), memory_state, sparse_binding.memoryOffset, offset, size);
+            const VkSparseImageMemoryBindInfo &image_bind = bind_info.pImageBinds[j];
+            if (auto image_state = Get<Image>(image_bind.image)) {
+                binds.clear();
+                for (uint32_t k = 0; k < image_bind.bindCount; k++) {
+                    const VkSparseImageMemoryBind &sparse_binding = image_bind.pBinds[k];
+                    // TODO: This size is broken for non-opaque bindings, need to update to comprehend full sparse binding data
+                    VkDeviceSize size =
+                        sparse_binding.extent.depth * sparse_binding.extent.height * sparse_binding.extent.width * 4;
+                    VkDeviceSize offset = sparse_binding.offset.z * sparse_binding.offset.y * sparse_binding.offset.x * 4;
+                    binds.push_back({Get<DeviceMemory>(sparse_binding.memory), sparse_binding.memoryOffset, offset, size});
                 }
+                image_state->BindMemoryRanges(image_state.get(), binds);
             }
         }
         auto* timeline_info = vku::FindStructInPNextChain<VkTimelineSemaphoreSubmitInfo>(bind_info.pNext);
@@ -1859,6 +1941,20 @@ void DeviceState::PreCallRecordDestroyPipelineCache(VkDevice device, VkPipelineC
     Destroy<PipelineCache>(pipelineCache);
 }
 
+// Fills pipeline_states with create(i) for each of the |count| pCreateInfos. The vvl::Pipeline constructors only read other state
+// objects, so large batches are spread over the worker pool; pipeline_states[i] always matches pCreateInfos[i].
+static void BuildPipelineStates(WorkerPool &worker_pool, uint32_t count, PipelineStates &pipeline_states,
+                                const std::function<std::shared_ptr<Pipeline>(uint32_t)> &create) {
+    pipeline_states.resize(count);
+    if (count < DeviceState::kParallelPipelineBatchThreshold) {
+        for (uint32_t i = 0; i < count; i++) {
+            pipeline_states[i] = create(i);
+        }
+    } else {
+        worker_pool.ParallelFor(count, [&pipeline_states, &create](uint32_t i) { pipeline_states[i] = create(i); });
+    }
+}
+
 std::shared_ptr<Pipeline> DeviceState::CreateGraphicsPipelineState(
     const VkGraphicsPipelineCreateInfo *create_info, std::shared_ptr<const PipelineCache> pipeline_cache,
     std::shared_ptr<const RenderPass> &&render_pass, std::shared_ptr<const PipelineLayout> &&layout,
@@ -1875,9 +1971,8 @@ bool DeviceState::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipe
                                                          chassis::CreateGraphicsPipelines &chassis_state) const {
     bool skip = false;
     // Set up the state that CoreChecks, gpu_validation and later StateTracker Record will use.
-    pipeline_states.reserve(count);
     auto pipeline_cache = Get<PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    BuildPipelineStates(worker_pool_, count, pipeline_states, [&](uint32_t i) {
         const auto &create_info = pCreateInfos[i];
         auto layout_state = Get<PipelineLayout>(create_info.layout);
         std::shared_ptr<const RenderPass> render_pass;
@@ -1896,9 +1991,10 @@ bool DeviceState::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipe
 
             render_pass = std::make_shared<RenderPass>(pipeline_rendering_ci, rasterization_enabled);
         }
-        pipeline_states.push_back(CreateGraphicsPipelineState(&create_info, pipeline_cache, std::move(render_pass),
-                                                              std::move(layout_state), chassis_state.stateless_data));
-    }
+        // Only the first pipeline gets stateless SPIR-V validation (see CoreChecks), the others don't need to fill it in
+        return CreateGraphicsPipelineState(&create_info, pipeline_cache, std::move(render_pass), std::move(layout_state),
+                                           i == 0 ? chassis_state.stateless_data : nullptr);
+    });
     return skip;
 }
 
@@ -1932,13 +2028,12 @@ bool DeviceState::PreCallValidateCreateComputePipelines(VkDevice device, VkPipel
                                                         const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                         const ErrorObject &error_obj, PipelineStates &pipeline_states,
                                                         chassis::CreateComputePipelines &chassis_state) const {
-    pipeline_states.reserve(count);
     auto pipeline_cache = Get<PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    BuildPipelineStates(worker_pool_, count, pipeline_states, [&](uint32_t i) {
         // Create and initialize internal tracking data structure
-        pipeline_states.push_back(CreateComputePipelineState(
-            &pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout), &chassis_state.stateless_data));
-    }
+        return CreateComputePipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout),
+                                          i == 0 ? &chassis_state.stateless_data : nullptr);
+    });
     return false;
 }
 
@@ -1972,13 +2067,12 @@ bool DeviceState::PreCallValidateCreateRayTracingPipelinesNV(VkDevice device, Vk
                                                              const VkRayTracingPipelineCreateInfoNV *pCreateInfos,
                                                              const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                              const ErrorObject &error_obj, PipelineStates &pipeline_states) const {
-    pipeline_states.reserve(count);
     auto pipeline_cache = Get<PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    BuildPipelineStates(worker_pool_, count, pipeline_states, [&](uint32_t i) {
         // Create and initialize internal tracking data structure
-        pipeline_states.push_back(
-            CreateRayTracingPipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout), nullptr));
-    }
+        return CreateRayTracingPipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout),
+                                             nullptr);
+    });
     return false;
 }
 
@@ -2013,13 +2107,12 @@ bool DeviceState::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice device, V
                                                               const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                               const ErrorObject &error_obj, PipelineStates &pipeline_states,
                                                               chassis::CreateRayTracingPipelinesKHR &chassis_state) const {
-    pipeline_states.reserve(count);
     auto pipeline_cache = Get<PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    BuildPipelineStates(worker_pool_, count, pipeline_states, [&](uint32_t i) {
         // Create and initialize internal tracking data structure
-        pipeline_states.push_back(
-            CreateRayTracingPipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout), nullptr));
-    }
+        return CreateRayTracingPipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout),
+                                             nullptr);
+    });
     return false;
 }
 
@@ -4658,16 +4751,12 @@ void DeviceState::PostCallRecordResetQueryPool(VkDevice device, VkQueryPool quer
     ASSERT_AND_RETURN(query_pool_state);
 
     // Reset the state of existing entries.
-    const uint32_t max_query_count = std::min(queryCount, query_pool_state->create_info.queryCount - firstQuery);
-    for (uint32_t i = 0; i < max_query_count; ++i) {
-        auto query_index = firstQuery + i;
-        query_pool_state->SetQueryState(query_index, 0, QUERYSTATE_RESET);
-        if (query_pool_state->create_info.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
-            for (uint32_t pass_index = 0; pass_index < query_pool_state->n_performance_passes; pass_index++) {
-                query_pool_state->SetQueryState(query_index, pass_index, QUERYSTATE_RESET);
-            }
-        }
+    if (firstQuery >= query_pool_state->create_info.queryCount) {
+        return;
     }
+    const uint32_t max_query_count = std::min(queryCount, query_pool_state->create_info.queryCount - firstQuery);
+    // Resetting applies to every performance pass
+    query_pool_state->SetQueryStates(firstQuery, max_query_count, 0, QUERYSTATE_RESET);
 }
 
 void DeviceState::PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
@@ -5736,12 +5825,17 @@ void DeviceState::PostCallRecordGetBufferDeviceAddress(VkDevice device, const Vk
     if (record_obj.device_address == 0) return;
     if (auto buffer_state = Get<Buffer>(pInfo->buffer)) {
         WriteLockGuard guard(buffer_address_lock_);
+        // Applications may query the address of the same buffer every frame, don't make the lookups go stale for nothing
+        if (buffer_state->deviceAddress == record_obj.device_address) {
+            return;
+        }
         // address is used for GPU-AV and ray tracing buffer validation
         buffer_state->deviceAddress = record_obj.device_address;
         const auto address_range = buffer_state->DeviceAddressRange();
 
         BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
         sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+        buffer_address_map_version_++;
         buffer_device_address_ranges_version++;
     }
 }
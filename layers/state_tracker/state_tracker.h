@@ -24,6 +24,7 @@
 #include "utils/hash_vk_types.h"
 #include "state_tracker/video_session_state.h"  // TODO - Remove from this header
 #include "state_tracker/special_supported.h"
+#include "state_tracker/shader_module.h"
 #include "device_state.h"
 #include "chassis/dispatch_object.h"
 #include "error_message/logging.h"
@@ -31,6 +32,7 @@
 #include "containers/custom_containers.h"
 #include "utils/android_ndk_types.h"
 #include "utils/vk_api_utils.h"
+#include "utils/thread_pool.h"
 #include "containers/range_map.h"
 #include <vulkan/utility/vk_struct_helper.hpp>
 #include <atomic>
@@ -673,17 +675,13 @@ class DeviceState : public vvl::base::Device {
     // more efficient to store them using raw pointers. It is safe to do so (at time of writing) because those raw pointers come
     // from shared ones created when the buffer is first recorded, and they are removed from buffer_address_map_ at BufferDestroy
     // time
-    vvl::span<vvl::Buffer* const> GetBuffersByAddress(VkDeviceAddress address) const {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer* const>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
-    }
+    // The list is returned by copy, as it usually holds a single buffer and lookups don't hold buffer_address_lock_
+    using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
+    using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
+    using BufferAddressRange = vvl::range<VkDeviceAddress>;
+    BufferAddressMapStore GetBuffersByAddress(VkDeviceAddress address) const;
 
     // Return a count pair, {written addresses count, total address ranges count}
-    using BufferAddressRange = vvl::range<VkDeviceAddress>;
     [[nodiscard]] size_t GetBufferAddressRangesCount() { return buffer_address_map_.size(); }
     void GetBufferAddressRanges(BufferAddressRange* ranges) const {
         ReadLockGuard guard(buffer_address_lock_);
@@ -1926,9 +1924,12 @@ class DeviceState : public vvl::base::Device {
     uint32_t buffer_device_address_ranges_version = 0;
 
     mutable vvl::VideoProfileDesc::Cache video_profile_cache_;
-
-    using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
-    using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
+    // Shares the parsed SPIR-V of identical inline VkShaderModuleCreateInfo across pipelines
+    mutable spirv::ModuleCache spirv_module_cache_;
+    // Used to split up the work of large vkCreate*Pipelines batches
+    mutable vvl::WorkerPool worker_pool_;
+    // Below this many pCreateInfos the cost of waking up the workers is more than the work itself
+    static constexpr uint32_t kParallelPipelineBatchThreshold = 8;
 
     // tracks which queue family index were used when creating the device for quick lookup
     vvl::unordered_set<uint32_t> queue_family_index_set;
@@ -1943,6 +1944,31 @@ class DeviceState : public vvl::base::Device {
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
     BufferAddressRangeMap buffer_address_map_;
     mutable std::shared_mutex buffer_address_lock_;
+    // Bumped (while holding buffer_address_lock_ for writing) every time buffer_address_map_ changes
+    std::atomic<uint64_t> buffer_address_map_version_{0};
+
+    // Immutable, sorted copy of buffer_address_map_ that GetBuffersByAddress binary searches without taking any lock.
+    // Rebuilt lazily once enough lookups had to fall back to the locked map to pay for the copy (so creating many buffers in a
+    // row doesn't rebuild it each time).
+    // Each thread keeps its own reference to the snapshot it last used. As long as buffer_address_map_version_ matches, a lookup
+    // only reads that atomic: it neither takes buffer_address_lock_ nor touches a reference count shared with other threads.
+    struct BufferAddressSnapshot {
+        uint64_t version = 0;
+        std::vector<BufferAddressRange> ranges;
+        std::vector<BufferAddressMapStore> buffers;  // buffers[i] is the list for ranges[i]
+
+        const BufferAddressMapStore* Find(VkDeviceAddress address) const;
+    };
+    // Must hold buffer_address_lock_ for writing
+    void PublishBufferAddressSnapshot() const;
+    // Fallback lookups before the snapshot is rebuilt is (map size / ratio)
+    static constexpr uint32_t kBufferAddressSnapshotRebuildRatio = 4;
+    // Guarded by buffer_address_lock_
+    mutable std::shared_ptr<const BufferAddressSnapshot> buffer_address_snapshot_;
+    mutable std::atomic<uint32_t> buffer_address_stale_lookups_{0};
+    // Tells the snapshots cached by each thread apart from the ones of another (or an earlier) device at the same address
+    static inline std::atomic<uint64_t> next_buffer_address_snapshot_owner_{1};
+    const uint64_t buffer_address_snapshot_owner_ = next_buffer_address_snapshot_owner_.fetch_add(1);
 
     // < external format, features >
     vvl::concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
@@ -2083,7 +2109,7 @@ class DeviceProxy : public vvl::base::Device {
         return device_state->AnyOf<State>(fn);
     }
 
-    vvl::span<vvl::Buffer* const> GetBuffersByAddress(VkDeviceAddress address) const {
+    vvl::DeviceState::BufferAddressMapStore GetBuffersByAddress(VkDeviceAddress address) const {
         return const_cast<const vvl::DeviceState*>(device_state)->GetBuffersByAddress(address);
     }
 
@@ -95,7 +95,7 @@ bool SpirvValidator::Validate(const spirv::Module &module_state, const spirv::St
         skip |= ValidateSubgroupRotateClustered(module_state, insn, loc);
     }
 
-    for (const auto &entry_point : module_state.static_data_.entry_points) {
+    for (const auto &entry_point : module_state.GetEntryPoints()) {
         skip |= ValidateShaderStageGroupNonUniform(module_state, stateless_data, entry_point->stage, loc);
         skip |= ValidateShaderStageInputOutputLimits(module_state, *entry_point, stateless_data, loc);
         skip |= ValidateShaderFloatControl(module_state, *entry_point, stateless_data, loc);
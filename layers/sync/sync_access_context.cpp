@@ -21,6 +21,7 @@
 #include "state_tracker/render_pass_state.h"
 #include "sync/sync_access_context.h"
 #include "sync/sync_image.h"
+#include "utils/thread_pool.h"
 
 bool SimpleBinding(const vvl::Bindable &bindable) { return !bindable.sparse && bindable.Binding(); }
 VkDeviceSize ResourceBaseAddress(const vvl::Buffer &buffer) { return buffer.GetFakeBaseAddress(); }
@@ -129,6 +130,59 @@ void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
     ConstForAll(gather);
 }
 
+// Returns shard_count + 1 iterators, shard i is [boundaries[i], boundaries[i + 1]). Empty if the map is too small to shard.
+template <typename Iterator>
+std::vector<Iterator> AccessContext::ShardBoundaries(Iterator begin, Iterator end, size_t size) {
+    std::vector<Iterator> boundaries;
+    const size_t shard_count = std::min(size / kShardSize, kMaxShardCount);
+    if (shard_count < 2) {
+        return boundaries;
+    }
+    const size_t shard_size = size / shard_count;
+    boundaries.reserve(shard_count + 1);
+    boundaries.emplace_back(begin);
+    for (size_t i = 1; i < shard_count; ++i) {
+        boundaries.emplace_back(std::next(boundaries.back(), shard_size));
+    }
+    boundaries.emplace_back(end);
+    return boundaries;
+}
+
+void AccessContext::TrimAndClearFirstAccess(vvl::WorkerPool &worker_pool) {
+    const auto boundaries = ShardBoundaries(access_state_map_.begin(), access_state_map_.end(), access_state_map_.size());
+    if (boundaries.empty()) {
+        TrimAndClearFirstAccess();
+        return;
+    }
+    // Normalize only changes the mapped values, so shards can be updated concurrently. Consolidation changes the tree.
+    const uint32_t shard_count = static_cast<uint32_t>(boundaries.size() - 1);
+    worker_pool.ParallelFor(shard_count, [&boundaries](uint32_t i) {
+        for (auto it = boundaries[i]; it != boundaries[i + 1]; ++it) {
+            it->second.Normalize();
+            it->second.ClearFirstUse();
+        }
+    });
+    sparse_container::consolidate(access_state_map_);
+}
+
+void AccessContext::AddReferencedTags(ResourceUsageTagSet &used, vvl::WorkerPool &worker_pool) const {
+    const auto boundaries = ShardBoundaries(access_state_map_.cbegin(), access_state_map_.cend(), access_state_map_.size());
+    if (boundaries.empty()) {
+        AddReferencedTags(used);
+        return;
+    }
+    const uint32_t shard_count = static_cast<uint32_t>(boundaries.size() - 1);
+    std::vector<ResourceUsageTagSet> shard_tags(shard_count);
+    worker_pool.ParallelFor(shard_count, [&boundaries, &shard_tags](uint32_t i) {
+        for (auto it = boundaries[i]; it != boundaries[i + 1]; ++it) {
+            it->second.GatherReferencedTags(shard_tags[i]);
+        }
+    });
+    for (const ResourceUsageTagSet &tags : shard_tags) {
+        used.insert(tags.begin(), tags.end());
+    }
+}
+
 template <typename Action>
 void AccessContext::ForAll(Action &&action) {
     for (auto &access : access_state_map_) {
@@ -145,7 +199,7 @@ void AccessContext::ConstForAll(Action &&action) const {
 
 void AccessContext::ResolveFromContext(const AccessContext &from) {
     const NoopBarrierAction noop_barrier;
-    from.ResolveAccessRange(kFullRange, noop_barrier, &access_state_map_, nullptr);
+    ResolveFromContext(noop_barrier, from, nullptr, true);
 }
 
 void AccessContext::ResolvePreviousAccess(const ResourceAccessRange &range, ResourceAccessRangeMap *descent_map,
@@ -556,6 +610,19 @@ HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const Resourc
     return {};
 }
 
+HazardResult AccessContext::DetectFirstUseHazard(
+    QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+    const std::vector<const ResourceAccessRangeMap::value_type *> &recorded_accesses) {
+    for (const auto *recorded_access : recorded_accesses) {
+        HazardDetectFirstUse detector(recorded_access->second, queue_id, tag_range);
+        HazardResult hazard = access_context.DetectHazardRange(detector, recorded_access->first, DetectOptions::kDetectAll);
+        if (hazard.IsHazard()) {
+            return hazard;
+        }
+    }
+    return {};
+}
+
 // For RenderPass time validation this is "start tag", for QueueSubmit, this is the earliest
 // unsynchronized tag for the Queue being tested against (max synchrononous + 1, perhaps)
 ResourceUsageTag AccessContext::AsyncReference::StartTag() const { return (tag_ == kInvalidTag) ? context_->StartTag() : tag_; }
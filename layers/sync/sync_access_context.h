@@ -30,6 +30,7 @@ class Image;
 class ImageView;
 class VideoPictureResource;
 class VideoSession;
+class WorkerPool;
 }  // namespace vvl
 
 bool SimpleBinding(const vvl::Bindable &bindable);
@@ -281,6 +282,10 @@ class AccessContext {
 
     HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
                                       const AccessContext &access_context) const;
+    // Same as above, but only for the given recorded entries instead of every entry of a recorded context
+    static HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
+                                             const AccessContext &access_context,
+                                             const std::vector<const ResourceAccessRangeMap::value_type *> &recorded_accesses);
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -340,6 +345,9 @@ class AccessContext {
     void Trim();
     void TrimAndClearFirstAccess();
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
+    // Same as above, but large maps are split into shards of consecutive entries that are processed on the worker pool
+    void TrimAndClearFirstAccess(vvl::WorkerPool &worker_pool);
+    void AddReferencedTags(ResourceUsageTagSet &referenced, vvl::WorkerPool &worker_pool) const;
 
     ResourceAccessRangeMap &GetAccessStateMap() { return access_state_map_; }
     const ResourceAccessRangeMap &GetAccessStateMap() const { return access_state_map_; }
@@ -448,10 +456,17 @@ class AccessContext {
     template <typename NormalizeOp>
     void Trim(NormalizeOp &&normalize);
 
+    // Entries per shard for the parallel whole context passes. Per entry work is small, so shards need to be large
+    // to pay for the hand off to the worker pool.
+    static constexpr size_t kShardSize = 4096;
+    static constexpr size_t kMaxShardCount = 64;
+    template <typename Iterator>
+    static std::vector<Iterator> ShardBoundaries(Iterator begin, Iterator end, size_t size);
+
     template <typename Detector>
     HazardResult DetectPreviousHazard(Detector &detector, const ResourceAccessRange &range) const;
 
-    ResourceAccessRangeMap access_state_map_;
+    ResourceAccessRangeMap access_state_map_{ResourceAccessRangeMap::allocator_type::WithPool()};
     std::vector<TrackBack> prev_;
     std::vector<TrackBack *> prev_by_subpass_;
     // These contexts *must* have the same lifespan as this context, or be cleared, before the referenced contexts can expire
@@ -701,6 +716,16 @@ void AccessContext::EraseIf(Predicate &&pred) {
 template <typename ResolveOp>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
+    if (access_state_map_.empty() && !infill_state && from_context.prev_.empty()) {
+        // Nothing to merge with and no gaps to fill: the result is the source map with resolve_op applied to each entry.
+        // This is the usual case for a new queue batch importing its predecessor. Copying the tree is linear and
+        // skips the per entry lookups and inserts of the merge walk.
+        access_state_map_ = from_context.access_state_map_;
+        for (auto &access : access_state_map_) {
+            resolve_op(&access.second);
+        }
+        return;
+    }
     from_context.ResolveAccessRange(kFullRange, resolve_op, &access_state_map_, infill_state, recur_to_infill);
 }
 
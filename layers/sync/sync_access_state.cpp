@@ -16,6 +16,7 @@
  */
 #include "sync/sync_access_state.h"
 #include "utils/sync_utils.h"
+#include "utils/math_utils.h"
 #include <vulkan/utility/vk_struct_helper.hpp>
 
 static bool IsRead(SyncAccessIndex access) { return syncAccessReadMask[access]; }
@@ -633,8 +634,12 @@ bool ResourceAccessState::WaitAcquirePredicate::operator()(const ResourceAccessS
 
 bool ResourceAccessState::FirstAccessInTagRange(const ResourceUsageRange &tag_range) const {
     if (!first_accesses_.size()) return false;
-    const ResourceUsageRange first_access_range = {first_accesses_.front().tag, first_accesses_.back().tag + 1};
-    return tag_range.intersects(first_access_range);
+    return tag_range.intersects(FirstAccessTagRange());
+}
+
+ResourceUsageRange ResourceAccessState::FirstAccessTagRange() const {
+    if (!first_accesses_.size()) return ResourceUsageRange(0, 0);
+    return ResourceUsageRange(first_accesses_.front().tag, first_accesses_.back().tag + 1);
 }
 
 void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
@@ -996,15 +1001,31 @@ static VkPipelineStageFlags2 WithLaterPipelineStages(VkPipelineStageFlags2 stage
     return stage_mask | RelatedPipelineStages(stage_mask, syncLogicallyLaterStages());
 }
 
-template <typename Flags, typename Map>
-static SyncAccessFlags AccessScopeImpl(Flags flag_mask, const Map &map) {
-    SyncAccessFlags scope;
-    for (const auto &bit_scope : map) {
-        if (flag_mask < bit_scope.first) break;
+// Access scope of each stage or access flag bit, indexed by bit position. Built once from the generated maps so that
+// the scope of a mask is an OR over its set bits instead of a walk over the whole map for every barrier.
+using AccessScopeTable = std::array<SyncAccessFlags, 64>;
 
-        if (flag_mask & bit_scope.first) {
-            scope |= bit_scope.second;
-        }
+// Index of the lowest set bit of a non-zero mask
+static uint32_t LowestBitIndex(uint64_t mask) {
+    const uint32_t low = static_cast<uint32_t>(mask);
+    return low ? LeastSignificantBit(low) : 32 + LeastSignificantBit(static_cast<uint32_t>(mask >> 32));
+}
+
+template <typename Map>
+static AccessScopeTable MakeAccessScopeTable(const Map &map) {
+    AccessScopeTable table;
+    for (const auto &[bit, scope] : map) {
+        if (bit == 0) continue;
+        assert(IsSingleBitSet(static_cast<uint64_t>(bit)));
+        table[LowestBitIndex(bit)] |= scope;
+    }
+    return table;
+}
+
+static SyncAccessFlags AccessScopeImpl(uint64_t flag_mask, const AccessScopeTable &table) {
+    SyncAccessFlags scope;
+    for (; flag_mask != 0; flag_mask &= flag_mask - 1) {
+        scope |= table[LowestBitIndex(flag_mask)];
     }
     return scope;
 }
@@ -1026,11 +1047,13 @@ static VkAccessFlags2 ExpandAccessFlags(VkAccessFlags2 access_mask) {
 }
 
 static SyncAccessFlags AccessScopeByStage(VkPipelineStageFlags2 stages) {
-    return AccessScopeImpl(stages, syncAccessMaskByStageBit());
+    static const AccessScopeTable table = MakeAccessScopeTable(syncAccessMaskByStageBit());
+    return AccessScopeImpl(stages, table);
 }
 
 static SyncAccessFlags AccessScopeByAccess(VkAccessFlags2 accesses) {
-    SyncAccessFlags sync_accesses = AccessScopeImpl(ExpandAccessFlags(accesses), syncAccessMaskByAccessBit());
+    static const AccessScopeTable table = MakeAccessScopeTable(syncAccessMaskByAccessBit());
+    SyncAccessFlags sync_accesses = AccessScopeImpl(ExpandAccessFlags(accesses), table);
 
     // The above access expansion replaces SHADER_READ meta access with atomic accesses as defined by the specification.
     // ACCELERATION_STRUCTURE_BUILD and MICROMAP_BUILD stages are special in a way that they use SHADER_READ access directly.
@@ -17,6 +17,7 @@
 
 #pragma once
 #include "sync/sync_common.h"
+#include "containers/node_pool_allocator.h"
 
 class ResourceAccessState;
 class WriteState;
@@ -396,6 +397,8 @@ class ResourceAccessState {
     bool ApplyPredicatedWait(Predicate &predicate);
 
     bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const;
+    // Range from the first to the last first access tag, empty when there are no first accesses
+    ResourceUsageRange FirstAccessTagRange() const;
 
     void OffsetTag(ResourceUsageTag offset);
     ResourceAccessState();
@@ -526,7 +529,13 @@ class ResourceAccessState {
     static OrderingBarriers kOrderingRules;
 };
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
-using ResourceAccessRangeMap = sparse_container::range_map<ResourceAddress, ResourceAccessState>;
+// Access maps are split, merged and copied for nearly every recorded command. A long-lived map (the one of an AccessContext)
+// keeps its nodes in its own pool, which avoids a system heap round trip per node and keeps neighboring ranges close in
+// memory. Default constructed maps, such as the temporary ones built during hazard detection, use the system heap.
+using ResourceAccessRangeMap =
+    sparse_container::range_map<ResourceAddress, ResourceAccessState, ResourceAccessRange,
+                                std::map<ResourceAccessRange, ResourceAccessState, std::less<ResourceAccessRange>,
+                                         vvl::node_pool_allocator<std::pair<const ResourceAccessRange, ResourceAccessState>>>>;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
 
 // Apply the memory barrier without updating the existing barriers.  The execution barrier
@@ -199,6 +199,64 @@ static SyncAccessIndex GetSyncStageAccessIndexsByDescriptorSet(VkDescriptorType
     }
 }
 
+void ResourceUsageLog::AddToRun(const vvl::CommandBuffer *cb_state, uint32_t reset_count) {
+    if (runs_.empty() || runs_.back().cb_state != cb_state || runs_.back().reset_count != reset_count) {
+        runs_.emplace_back(CommandBufferRun{static_cast<uint32_t>(entries_.size()), reset_count, cb_state});
+    }
+}
+
+ResourceUsageLog::Entry &ResourceUsageLog::Add(vvl::Func command, uint32_t seq_num, ResourceUsageRecord::SubcommandType sub_type,
+                                               const vvl::CommandBuffer *cb_state, uint32_t reset_count) {
+    AddToRun(cb_state, reset_count);
+    Entry &entry = entries_.emplace_back();
+    entry.command = command;
+    entry.seq_num = seq_num;
+    entry.sub_command_type = sub_type;
+    return entry;
+}
+
+void ResourceUsageLog::AddAlternateUsage(const AlternateResourceUsage::RecordBase &usage) {
+    AddToRun(nullptr, 0);
+    alternate_usages_.emplace_back(static_cast<uint32_t>(entries_.size()), AlternateResourceUsage(usage));
+    entries_.emplace_back().command = usage.GetCommand();
+}
+
+void ResourceUsageLog::Append(const ResourceUsageLog &other) {
+    const uint32_t offset = static_cast<uint32_t>(entries_.size());
+    for (const CommandBufferRun &run : other.runs_) {
+        if (!runs_.empty() && runs_.back().cb_state == run.cb_state && runs_.back().reset_count == run.reset_count) {
+            continue;
+        }
+        runs_.emplace_back(CommandBufferRun{run.first_index + offset, run.reset_count, run.cb_state});
+    }
+    entries_.insert(entries_.end(), other.entries_.begin(), other.entries_.end());
+    for (const auto &[index, usage] : other.alternate_usages_) {
+        alternate_usages_.emplace_back(index + offset, usage);
+    }
+}
+
+ResourceUsageRecord ResourceUsageLog::GetRecord(size_t index) const {
+    assert(index < entries_.size());
+    auto alternate = std::lower_bound(alternate_usages_.begin(), alternate_usages_.end(), index,
+                                      [](const auto &alternate_usage, size_t i) { return alternate_usage.first < i; });
+    if (alternate != alternate_usages_.end() && alternate->first == index) {
+        return ResourceUsageRecord(alternate->second);
+    }
+
+    // The run holding index is the last one starting at or before it
+    auto run = std::upper_bound(runs_.begin(), runs_.end(), index,
+                                [](size_t i, const CommandBufferRun &cb_run) { return i < cb_run.first_index; });
+    assert(run != runs_.begin());
+    --run;
+
+    const Entry &entry = entries_[index];
+    ResourceUsageRecord record(entry.command, entry.seq_num, entry.sub_command_type, run->cb_state, run->reset_count);
+    record.first_handle_index = entry.first_handle_index;
+    record.handle_count = entry.handle_count;
+    record.label_command_index = entry.label_command_index;
+    return record;
+}
+
 CommandExecutionContext::CommandExecutionContext(const SyncValidator &sync_validator, VkQueueFlags queue_flags)
     : sync_state_(sync_validator), error_messages_(sync_validator.error_messages_), queue_flags_(queue_flags) {}
 
@@ -266,6 +324,8 @@ void CommandBufferAccessContext::Reset() {
         cbs_referenced_->push_back(cb_state_->shared_from_this());
     }
     sync_ops_.clear();
+    first_use_segments_.clear();
+    first_use_context_ = nullptr;
     command_number_ = 0;
     reset_count_++;
 
@@ -279,6 +339,7 @@ void CommandBufferAccessContext::Reset() {
     current_renderpass_context_ = nullptr;
     events_context_.Clear();
     dynamic_rendering_info_.reset();
+    descriptor_access_cache_ = {};
 }
 
 bool CommandBufferAccessContext::ValidateBeginRendering(const ErrorObject &error_obj,
@@ -451,26 +512,33 @@ void CommandBufferAccessContext::RecordEndRendering(const RecordObject &record_o
     dynamic_rendering_info_.reset();
 }
 
-bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
-                                                                   const Location &loc) const {
-    bool skip = false;
-    if (!sync_state_.syncval_settings.shader_accesses_heuristic) {
-        return skip;
-    }
-    const auto &last_bound_state = cb_state_->lastBound[ConvertToVvlBindPoint(pipelineBindPoint)];
-    const vvl::Pipeline *pipe = last_bound_state.pipeline_state;
+const std::vector<CommandBufferAccessContext::DescriptorAccess> &CommandBufferAccessContext::GetDescriptorAccesses(
+    VkPipelineBindPoint pipelineBindPoint) const {
+    const vvl::BindPoint bind_point = ConvertToVvlBindPoint(pipelineBindPoint);
+    const auto &last_bound_state = cb_state_->lastBound[bind_point];
+    const vvl::Pipeline &pipe = *last_bound_state.pipeline_state;
     const std::vector<LastBound::DescriptorSetSlot> &ds_slots = last_bound_state.ds_slots;
-    if (!pipe) {
-        return skip;
+    DescriptorAccessCache &cache = descriptor_access_cache_[bind_point];
+
+    auto same_bound_set = [](const DescriptorAccessCache::BoundSet &cached, const LastBound::DescriptorSetSlot &ds_slot) {
+        return cached.set == ds_slot.ds_state && (!cached.set || cached.change_count == cached.set->GetChangeCount()) &&
+               cached.dynamic_offsets == ds_slot.dynamic_offsets;
+    };
+    if (cache.pipeline.get() == &pipe &&
+        std::equal(cache.sets.begin(), cache.sets.end(), ds_slots.begin(), ds_slots.end(), same_bound_set)) {
+        return cache.accesses;
     }
 
-    using DescriptorClass = vvl::DescriptorClass;
-    using BufferDescriptor = vvl::BufferDescriptor;
-    using ImageDescriptor = vvl::ImageDescriptor;
-    using TexelDescriptor = vvl::TexelDescriptor;
+    cache.pipeline = std::static_pointer_cast<const vvl::Pipeline>(pipe.shared_from_this());
+    cache.sets.clear();
+    for (const auto &ds_slot : ds_slots) {
+        const uint64_t change_count = ds_slot.ds_state ? ds_slot.ds_state->GetChangeCount() : 0;
+        cache.sets.emplace_back(DescriptorAccessCache::BoundSet{ds_slot.ds_state, change_count, ds_slot.dynamic_offsets});
+    }
+    cache.accesses.clear();
 
-    for (const auto &stage_state : pipe->stage_states) {
-        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && pipe->RasterizationDisabled()) {
+    for (const auto &stage_state : pipe.stage_states) {
+        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && pipe.RasterizationDisabled()) {
             continue;
         } else if (!stage_state.entrypoint) {
             continue;
@@ -498,121 +566,153 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
             }
 
             for (uint32_t index = 0; index < binding->count; index++) {
-                const auto *descriptor = binding->GetDescriptor(index);
-                switch (descriptor->GetClass()) {
-                    case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        if (descriptor->Invalid()) {
-                            continue;
-                        }
-
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        const auto *img_view_state = image_descriptor->GetImageViewState();
-                        VkImageLayout image_layout = image_descriptor->GetImageLayout();
-
-                        if (img_view_state->is_depth_sliced) {
-                            // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                            // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
-                            // See: VUID 00343
-                            continue;
-                        }
-
-                        HazardResult hazard;
-
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->render_area.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->render_area.offset);
-                            // Input attachments are subject to raster ordering rules
-                            hazard =
-                                current_context_->DetectHazard(*img_view_state, offset, extent, sync_index, SyncOrdering::kRaster);
-                        } else {
-                            hazard = current_context_->DetectHazard(*img_view_state, sync_index);
-                        }
-
-                        if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
-                            LogObjectList objlist(cb_state_->Handle(), img_view_state->Handle(), pipe->Handle());
-                            const auto error = error_messages_.ImageDescriptorError(
-                                hazard, *this, loc.function, sync_state_.FormatHandle(*img_view_state), *pipe,
-                                variable.decorations.set, *descriptor_set, descriptor_type, variable.decorations.binding, index,
-                                stage_state.GetStage(), image_layout);
-                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
-                        }
-                        break;
-                    }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
-                            LogObjectList objlist(cb_state_->Handle(), buf_view_state->Handle(), pipe->Handle());
-                            const auto error = error_messages_.BufferDescriptorError(
-                                hazard, *this, loc.function, sync_state_.FormatHandle(*buf_view_state), *pipe,
-                                variable.decorations.set, *descriptor_set, descriptor_type, variable.decorations.binding, index,
-                                stage_state.GetStage());
-                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
-                        }
-                        break;
-                    }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        VkDeviceSize offset = buffer_descriptor->GetOffset();
-                        if (vvl::IsDynamicDescriptor(descriptor_type)) {
-                            const uint32_t dynamic_offset_index =
-                                descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
-                            if (dynamic_offset_index >= ds_slot.dynamic_offsets.size()) {
-                                continue;  // core validation error
-                            }
-                            offset += ds_slot.dynamic_offsets[dynamic_offset_index];
-                        }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
-                        auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
-                        if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
-                            LogObjectList objlist(cb_state_->Handle(), buf_state->Handle(), pipe->Handle());
-                            const auto error = error_messages_.BufferDescriptorError(
-                                hazard, *this, loc.function, sync_state_.FormatHandle(*buf_state), *pipe, variable.decorations.set,
-                                *descriptor_set, descriptor_type, variable.decorations.binding, index, stage_state.GetStage());
-                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
-                        }
-                        break;
-                    }
-                    case DescriptorClass::AccelerationStructure: {
-                        const auto *accel_descriptor = static_cast<const vvl::AccelerationStructureDescriptor *>(descriptor);
-                        if (accel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const vvl::AccelerationStructureKHR *accel = accel_descriptor->GetAccelerationStructureStateKHR();
-                        if (!accel || !accel->buffer_state) {
-                            continue;
-                        }
-                        const ResourceAccessRange range =
-                            MakeRange(*accel->buffer_state, accel->create_info.offset, accel->create_info.size);
-                        auto hazard = current_context_->DetectHazard(*accel->buffer_state, sync_index, range);
-                        // TODO: figure out what is the purpose of SuppressedBoundDescriptorWAW and do we still need it?
-                        if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
-                            LogObjectList objlist(cb_state_->Handle(), accel->buffer_state->Handle(), pipe->Handle());
-                            const std::string resource_description = sync_state_.FormatHandle(accel->Handle());
-                            const std::string error = error_messages_.AccelerationStructureDescriptorError(
-                                hazard, *this, loc.function, resource_description, *pipe, variable.decorations.set, *descriptor_set,
-                                descriptor_type, variable.decorations.binding, index, stage_state.GetStage());
-                            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
-                        }
-                        break;
+                DescriptorAccess access;
+                access.descriptor = binding->GetDescriptor(index);
+                access.descriptor_set = descriptor_set;
+                access.descriptor_type = descriptor_type;
+                access.sync_index = sync_index;
+                access.stage = stage_state.GetStage();
+                access.set = variable.decorations.set;
+                access.binding = variable.decorations.binding;
+                access.index = index;
+                const bool dynamic_buffer = access.descriptor->GetClass() == vvl::DescriptorClass::GeneralBuffer &&
+                                            vvl::IsDynamicDescriptor(descriptor_type);
+                if (dynamic_buffer) {
+                    const uint32_t dynamic_offset_index = descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
+                    if (dynamic_offset_index >= ds_slot.dynamic_offsets.size()) {
+                        continue;  // core validation error
                     }
-                    // TODO: INLINE_UNIFORM_BLOCK_EXT
-                    default:
-                        break;
+                    access.dynamic_offset = ds_slot.dynamic_offsets[dynamic_offset_index];
+                }
+                cache.accesses.emplace_back(access);
+            }
+        }
+    }
+    return cache.accesses;
+}
+
+// The per descriptor checks are repeated for each draw: the descriptors can't change without bumping the set change count,
+// but the referenced resources can be destroyed.
+bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
+                                                                   const Location &loc) const {
+    bool skip = false;
+    if (!sync_state_.syncval_settings.shader_accesses_heuristic) {
+        return skip;
+    }
+    const vvl::Pipeline *pipe = cb_state_->lastBound[ConvertToVvlBindPoint(pipelineBindPoint)].pipeline_state;
+    if (!pipe) {
+        return skip;
+    }
+
+    using DescriptorClass = vvl::DescriptorClass;
+    using BufferDescriptor = vvl::BufferDescriptor;
+    using ImageDescriptor = vvl::ImageDescriptor;
+    using TexelDescriptor = vvl::TexelDescriptor;
+
+    for (const DescriptorAccess &access : GetDescriptorAccesses(pipelineBindPoint)) {
+        const auto *descriptor = access.descriptor;
+        const SyncAccessIndex sync_index = access.sync_index;
+        switch (descriptor->GetClass()) {
+            case DescriptorClass::ImageSampler:
+            case DescriptorClass::Image: {
+                if (descriptor->Invalid()) {
+                    continue;
+                }
+
+                // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
+                const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
+                const auto *img_view_state = image_descriptor->GetImageViewState();
+                VkImageLayout image_layout = image_descriptor->GetImageLayout();
+
+                if (img_view_state->is_depth_sliced) {
+                    // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
+                    // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
+                    // See: VUID 00343
+                    continue;
+                }
+
+                HazardResult hazard;
+
+                if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                    const VkExtent3D extent = CastTo3D(cb_state_->render_area.extent);
+                    const VkOffset3D offset = CastTo3D(cb_state_->render_area.offset);
+                    // Input attachments are subject to raster ordering rules
+                    hazard = current_context_->DetectHazard(*img_view_state, offset, extent, sync_index, SyncOrdering::kRaster);
+                } else {
+                    hazard = current_context_->DetectHazard(*img_view_state, sync_index);
+                }
+
+                if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
+                    LogObjectList objlist(cb_state_->Handle(), img_view_state->Handle(), pipe->Handle());
+                    const auto error = error_messages_.ImageDescriptorError(
+                        hazard, *this, loc.function, sync_state_.FormatHandle(*img_view_state), *pipe, access.set,
+                        *access.descriptor_set, access.descriptor_type, access.binding, access.index, access.stage, image_layout);
+                    skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+                }
+                break;
+            }
+            case DescriptorClass::TexelBuffer: {
+                const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
+                if (texel_descriptor->Invalid()) {
+                    continue;
+                }
+                const auto *buf_view_state = texel_descriptor->GetBufferViewState();
+                const auto *buf_state = buf_view_state->buffer_state.get();
+                const ResourceAccessRange range = MakeRange(*buf_view_state);
+                auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
+                    LogObjectList objlist(cb_state_->Handle(), buf_view_state->Handle(), pipe->Handle());
+                    const auto error = error_messages_.BufferDescriptorError(
+                        hazard, *this, loc.function, sync_state_.FormatHandle(*buf_view_state), *pipe, access.set,
+                        *access.descriptor_set, access.descriptor_type, access.binding, access.index, access.stage);
+                    skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+                }
+                break;
+            }
+            case DescriptorClass::GeneralBuffer: {
+                const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
+                if (buffer_descriptor->Invalid()) {
+                    continue;
                 }
+                const VkDeviceSize offset = buffer_descriptor->GetOffset() + access.dynamic_offset;
+                const auto *buf_state = buffer_descriptor->GetBufferState();
+                const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
+                auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
+                    LogObjectList objlist(cb_state_->Handle(), buf_state->Handle(), pipe->Handle());
+                    const auto error = error_messages_.BufferDescriptorError(
+                        hazard, *this, loc.function, sync_state_.FormatHandle(*buf_state), *pipe, access.set,
+                        *access.descriptor_set, access.descriptor_type, access.binding, access.index, access.stage);
+                    skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+                }
+                break;
+            }
+            case DescriptorClass::AccelerationStructure: {
+                const auto *accel_descriptor = static_cast<const vvl::AccelerationStructureDescriptor *>(descriptor);
+                if (accel_descriptor->Invalid()) {
+                    continue;
+                }
+                const vvl::AccelerationStructureKHR *accel = accel_descriptor->GetAccelerationStructureStateKHR();
+                if (!accel || !accel->buffer_state) {
+                    continue;
+                }
+                const ResourceAccessRange range =
+                    MakeRange(*accel->buffer_state, accel->create_info.offset, accel->create_info.size);
+                auto hazard = current_context_->DetectHazard(*accel->buffer_state, sync_index, range);
+                // TODO: figure out what is the purpose of SuppressedBoundDescriptorWAW and do we still need it?
+                if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
+                    LogObjectList objlist(cb_state_->Handle(), accel->buffer_state->Handle(), pipe->Handle());
+                    const std::string resource_description = sync_state_.FormatHandle(accel->Handle());
+                    const std::string error = error_messages_.AccelerationStructureDescriptorError(
+                        hazard, *this, loc.function, resource_description, *pipe, access.set, *access.descriptor_set,
+                        access.descriptor_type, access.binding, access.index, access.stage);
+                    skip |= sync_state_.SyncError(hazard.Hazard(), objlist, loc, error);
+                }
+                break;
             }
+            // TODO: INLINE_UNIFORM_BLOCK_EXT
+            default:
+                break;
         }
     }
     return skip;
@@ -624,11 +724,7 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
     if (!sync_state_.syncval_settings.shader_accesses_heuristic) {
         return;
     }
-
-    const auto &last_bound_state = cb_state_->lastBound[ConvertToVvlBindPoint(pipelineBindPoint)];
-    const vvl::Pipeline *pipe = last_bound_state.pipeline_state;
-    const std::vector<LastBound::DescriptorSetSlot> &ds_slots = last_bound_state.ds_slots;
-    if (!pipe) {
+    if (!cb_state_->lastBound[ConvertToVvlBindPoint(pipelineBindPoint)].pipeline_state) {
         return;
     }
 
@@ -637,110 +733,77 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
     using ImageDescriptor = vvl::ImageDescriptor;
     using TexelDescriptor = vvl::TexelDescriptor;
 
-    for (const auto &stage_state : pipe->stage_states) {
-        if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && pipe->RasterizationDisabled()) {
-            continue;
-        } else if (!stage_state.entrypoint) {
-            continue;
-        }
-        for (const auto &variable : stage_state.entrypoint->resource_interface_variables) {
-            if (variable.decorations.set >= ds_slots.size()) {
-                // This should be caught by Core validation, but if core checks are disabled SyncVal should not crash.
-                continue;
+    // Validate has already built the access list for this draw, so this is a cache hit
+    for (const DescriptorAccess &access : GetDescriptorAccesses(pipelineBindPoint)) {
+        const auto *descriptor = access.descriptor;
+        const SyncAccessIndex sync_index = access.sync_index;
+        switch (descriptor->GetClass()) {
+            case DescriptorClass::ImageSampler:
+            case DescriptorClass::Image: {
+                // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
+                const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
+                if (image_descriptor->Invalid()) {
+                    continue;
+                }
+                const auto *img_view_state = image_descriptor->GetImageViewState();
+                if (img_view_state->is_depth_sliced) {
+                    // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
+                    // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
+                    // See: VUID 00343
+                    continue;
+                }
+                const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, img_view_state->image_state->Handle());
+                if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
+                    const VkExtent3D extent = CastTo3D(cb_state_->render_area.extent);
+                    const VkOffset3D offset = CastTo3D(cb_state_->render_area.offset);
+                    current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kRaster, offset, extent, tag_ex);
+                } else {
+                    current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, tag_ex);
+                }
+                break;
             }
-            const auto &ds_slot = ds_slots[variable.decorations.set];
-            const auto *descriptor_set = ds_slot.ds_state.get();
-            if (!descriptor_set) continue;
-            auto binding = descriptor_set->GetBinding(variable.decorations.binding);
-            const auto descriptor_type = binding->type;
-            SyncAccessIndex sync_index = GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, stage_state.GetStage());
-
-            // Do not update state for descriptor array (the same as in Validate function).
-            if (binding->count > 1) {
-                continue;
+            case DescriptorClass::TexelBuffer: {
+                const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
+                if (texel_descriptor->Invalid()) {
+                    continue;
+                }
+                const auto *buf_view_state = texel_descriptor->GetBufferViewState();
+                const auto *buf_state = buf_view_state->buffer_state.get();
+                const ResourceAccessRange range = MakeRange(*buf_view_state);
+                const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_view_state->Handle());
+                current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
+                break;
             }
-
-            for (uint32_t i = 0; i < binding->count; i++) {
-                const auto *descriptor = binding->GetDescriptor(i);
-                switch (descriptor->GetClass()) {
-                    case DescriptorClass::ImageSampler:
-                    case DescriptorClass::Image: {
-                        // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
-                        const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        if (image_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *img_view_state = image_descriptor->GetImageViewState();
-                        if (img_view_state->is_depth_sliced) {
-                            // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
-                            // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
-                            // See: VUID 00343
-                            continue;
-                        }
-                        const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, img_view_state->image_state->Handle());
-                        if (sync_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ) {
-                            const VkExtent3D extent = CastTo3D(cb_state_->render_area.extent);
-                            const VkOffset3D offset = CastTo3D(cb_state_->render_area.offset);
-                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kRaster, offset, extent,
-                                                                tag_ex);
-                        } else {
-                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, tag_ex);
-                        }
-                        break;
-                    }
-                    case DescriptorClass::TexelBuffer: {
-                        const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
-                        const auto *buf_state = buf_view_state->buffer_state.get();
-                        const ResourceAccessRange range = MakeRange(*buf_view_state);
-                        const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_view_state->Handle());
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
-                        break;
-                    }
-                    case DescriptorClass::GeneralBuffer: {
-                        const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
-                            continue;
-                        }
-                        VkDeviceSize offset = buffer_descriptor->GetOffset();
-                        if (vvl::IsDynamicDescriptor(descriptor_type)) {
-                            const uint32_t dynamic_offset_index =
-                                descriptor_set->GetDynamicOffsetIndexFromBinding(binding->binding);
-                            if (dynamic_offset_index >= ds_slot.dynamic_offsets.size()) {
-                                continue;  // core validation error
-                            }
-                            offset += ds_slot.dynamic_offsets[dynamic_offset_index];
-                        }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
-                        const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
-                        const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_state->Handle());
-                        current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
-                        break;
-                    }
-                    case DescriptorClass::AccelerationStructure: {
-                        const auto *accel_descriptor = static_cast<const vvl::AccelerationStructureDescriptor *>(descriptor);
-                        if (accel_descriptor->Invalid()) {
-                            continue;
-                        }
-                        const vvl::AccelerationStructureKHR *accel = accel_descriptor->GetAccelerationStructureStateKHR();
-                        if (!accel || !accel->buffer_state) {
-                            continue;
-                        }
-                        const ResourceAccessRange range =
-                            MakeRange(*accel->buffer_state, accel->create_info.offset, accel->create_info.size);
-                        const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, accel->Handle());
-                        current_context_->UpdateAccessState(*accel->buffer_state, sync_index, SyncOrdering::kNonAttachment, range,
-                                                            tag_ex);
-                        break;
-                    }
-                    // TODO: INLINE_UNIFORM_BLOCK_EXT
-                    default:
-                        break;
+            case DescriptorClass::GeneralBuffer: {
+                const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
+                if (buffer_descriptor->Invalid()) {
+                    continue;
                 }
+                const VkDeviceSize offset = buffer_descriptor->GetOffset() + access.dynamic_offset;
+                const auto *buf_state = buffer_descriptor->GetBufferState();
+                const ResourceAccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
+                const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_state->Handle());
+                current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
+                break;
+            }
+            case DescriptorClass::AccelerationStructure: {
+                const auto *accel_descriptor = static_cast<const vvl::AccelerationStructureDescriptor *>(descriptor);
+                if (accel_descriptor->Invalid()) {
+                    continue;
+                }
+                const vvl::AccelerationStructureKHR *accel = accel_descriptor->GetAccelerationStructureStateKHR();
+                if (!accel || !accel->buffer_state) {
+                    continue;
+                }
+                const ResourceAccessRange range =
+                    MakeRange(*accel->buffer_state, accel->create_info.offset, accel->create_info.size);
+                const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, accel->Handle());
+                current_context_->UpdateAccessState(*accel->buffer_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
+                break;
             }
+            // TODO: INLINE_UNIFORM_BLOCK_EXT
+            default:
+                break;
         }
     }
 }
@@ -1219,7 +1282,7 @@ void CommandBufferAccessContext::ResolveExecutedCommandBuffer(const AccessContex
 
 void CommandBufferAccessContext::ImportRecordedAccessLog(const CommandBufferAccessContext &recorded_context) {
     cbs_referenced_->emplace_back(recorded_context.GetCBStateShared());
-    access_log_->insert(access_log_->end(), recorded_context.access_log_->cbegin(), recorded_context.access_log_->cend());
+    access_log_->Append(*recorded_context.access_log_);
 
     // Adjust command indices for the log records added from recorded_context.
     const auto &recorded_label_commands = recorded_context.cb_state_->GetLabelCommands();
@@ -1228,19 +1291,19 @@ void CommandBufferAccessContext::ImportRecordedAccessLog(const CommandBufferAcce
     if (!label_commands.empty()) {
         assert(label_commands.size() >= recorded_label_commands.size());
         const uint32_t command_offset = static_cast<uint32_t>(label_commands.size() - recorded_label_commands.size());
-        for (size_t i = 0; i < recorded_context.access_log_->size(); i++) {
-            size_t index = (access_log_->size() - 1) - i;
-            assert((*access_log_)[index].label_command_index != vvl::kU32Max);
-            (*access_log_)[index].label_command_index += command_offset;
+        for (size_t i = 0; i < recorded_context.access_log_->Size(); i++) {
+            size_t index = (access_log_->Size() - 1) - i;
+            assert(access_log_->GetEntry(index).label_command_index != vvl::kU32Max);
+            access_log_->GetEntry(index).label_command_index += command_offset;
         }
     }
 }
 
 ResourceUsageTag CommandBufferAccessContext::NextCommandTag(vvl::Func command, ResourceUsageRecord::SubcommandType subcommand) {
     command_number_++;
-    current_command_tag_ = access_log_->size();
+    current_command_tag_ = access_log_->Size();
 
-    ResourceUsageRecord &record = access_log_->emplace_back(command, command_number_, subcommand, cb_state_, reset_count_);
+    ResourceUsageLog::Entry &record = access_log_->Add(command, command_number_, subcommand, cb_state_, reset_count_);
 
     if (!cb_state_->GetLabelCommands().empty()) {
         record.label_command_index = static_cast<uint32_t>(cb_state_->GetLabelCommands().size() - 1);
@@ -1250,11 +1313,11 @@ ResourceUsageTag CommandBufferAccessContext::NextCommandTag(vvl::Func command, R
 }
 
 ResourceUsageTag CommandBufferAccessContext::NextSubcommandTag(vvl::Func command, ResourceUsageRecord::SubcommandType subcommand) {
-    const ResourceUsageTag tag = access_log_->size();
-    ResourceUsageRecord &record = access_log_->emplace_back(command, command_number_, subcommand, cb_state_, reset_count_);
+    const ResourceUsageTag tag = access_log_->Size();
+    ResourceUsageLog::Entry &record = access_log_->Add(command, command_number_, subcommand, cb_state_, reset_count_);
 
     // By default copy handle range from the main command, but can be overwritten with AddSubcommandHandle.
-    const auto &main_command_record = (*access_log_)[current_command_tag_];
+    const auto &main_command_record = access_log_->GetEntry(current_command_tag_);
     record.first_handle_index = main_command_record.first_handle_index;
     record.handle_count = main_command_record.handle_count;
 
@@ -1277,11 +1340,11 @@ ResourceUsageTagEx CommandBufferAccessContext::AddCommandHandle(ResourceUsageTag
 
 ResourceUsageTagEx CommandBufferAccessContext::AddCommandHandleIndexed(ResourceUsageTag tag, const VulkanTypedHandle &typed_handle,
                                                                        uint32_t index) {
-    assert(tag < access_log_->size());
+    assert(tag < access_log_->Size());
     const uint32_t handle_index = AddHandle(typed_handle, index);
     // TODO: the following range check is not needed. Test and remove.
-    if (tag < access_log_->size()) {
-        auto &record = (*access_log_)[tag];
+    if (tag < access_log_->Size()) {
+        auto &record = access_log_->GetEntry(tag);
         if (record.first_handle_index == vvl::kNoIndex32) {
             record.first_handle_index = handle_index;
             record.handle_count = 1;
@@ -1296,12 +1359,12 @@ ResourceUsageTagEx CommandBufferAccessContext::AddCommandHandleIndexed(ResourceU
 
 void CommandBufferAccessContext::AddSubcommandHandleIndexed(ResourceUsageTag tag, const VulkanTypedHandle &typed_handle,
                                                             uint32_t index) {
-    assert(tag < access_log_->size());
+    assert(tag < access_log_->Size());
     const uint32_t handle_index = AddHandle(typed_handle, index);
     // TODO: the following range check is not needed. Test and remove.
-    if (tag < access_log_->size()) {
-        auto &record = (*access_log_)[tag];
-        const auto &main_command_record = (*access_log_)[current_command_tag_];
+    if (tag < access_log_->Size()) {
+        auto &record = access_log_->GetEntry(tag);
+        const auto &main_command_record = access_log_->GetEntry(current_command_tag_);
         if (record.first_handle_index == main_command_record.first_handle_index) {
             // override default behavior that subcommand references the same handles as the main command
             record.first_handle_index = handle_index;
@@ -1337,6 +1400,45 @@ void CommandBufferAccessContext::RecordSyncOp(SyncOpPointer &&sync_op) {
 // VK_SYNCVAL_DEBUG_COMMAND_NUMBER: the command number
 // VK_SYNCVAL_DEBUG_RESET_COUNT: (optional, default value is 1) command buffer reset count
 // VK_SYNCVAL_DEBUG_CMDBUF_PATTERN: (optional, empty string by default) pattern to match command buffer debug name
+void CommandBufferAccessContext::BuildFirstUseSegments() {
+    first_use_segments_.clear();
+    first_use_context_ = GetCurrentAccessContext();
+    if (!first_use_context_) return;
+
+    // Segment i covers the tags between sync op i - 1 and sync op i, the last one runs to the end of the command buffer
+    const size_t segment_count = sync_ops_.size() + 1;
+    auto segment_range = [this, segment_count](size_t segment) {
+        const ResourceUsageTag begin = (segment == 0) ? 0 : sync_ops_[segment - 1].tag + 1;
+        const ResourceUsageTag end = (segment + 1 == segment_count) ? ResourceUsageRecord::kMaxIndex : sync_ops_[segment].tag;
+        return ResourceUsageRange(begin, end);
+    };
+
+    first_use_segments_.resize(segment_count);
+    for (const auto &recorded_access : first_use_context_->GetAccessStateMap()) {
+        const ResourceUsageRange first_tags = recorded_access.second.FirstAccessTagRange();
+        if (!first_tags.non_empty()) continue;
+
+        // Segments ending at or before the first tag can't hold any of the first accesses
+        size_t segment = std::upper_bound(sync_ops_.begin(), sync_ops_.end(), first_tags.begin,
+                                          [](ResourceUsageTag tag, const SyncOpEntry &sync_op) { return tag < sync_op.tag; }) -
+                         sync_ops_.begin();
+        for (; segment < segment_count; ++segment) {
+            const ResourceUsageRange range = segment_range(segment);
+            if (range.begin >= first_tags.end) break;
+            // Replay skips empty segments
+            if (range.non_empty() && range.intersects(first_tags)) {
+                first_use_segments_[segment].emplace_back(&recorded_access);
+            }
+        }
+    }
+}
+
+const CommandBufferAccessContext::FirstUseSegment *CommandBufferAccessContext::GetFirstUseSegment(
+    const AccessContext *recorded_context, size_t segment) const {
+    if (recorded_context != first_use_context_ || segment >= first_use_segments_.size()) return nullptr;
+    return &first_use_segments_[segment];
+}
+
 void CommandBufferAccessContext::CheckCommandTagDebugCheckpoint() {
     auto get_cmdbuf_name = [](const DebugReport &debug_report, uint64_t cmdbuf_handle) {
         std::unique_lock<std::mutex> lock(debug_report.debug_output_mutex);
@@ -1352,7 +1454,7 @@ void CommandBufferAccessContext::CheckCommandTagDebugCheckpoint() {
         const auto &pattern = sync_state_.debug_cmdbuf_pattern;
         const bool cmdbuf_match = pattern.empty() || (cmdbuf_name.find(pattern) != std::string::npos);
         if (cmdbuf_match) {
-            sync_state_.LogInfo("SYNCVAL_DEBUG_COMMAND", LogObjectList(), Location(access_log_->back().command),
+            sync_state_.LogInfo("SYNCVAL_DEBUG_COMMAND", LogObjectList(), Location(access_log_->Back().command),
                                 "Command stream has reached command #%" PRIu32 " in command buffer %s with reset count #%" PRIu32,
                                 sync_state_.debug_command_number, sync_state_.FormatHandle(cb_state_->Handle()).c_str(),
                                 sync_state_.debug_reset_count);
@@ -1370,7 +1472,10 @@ CommandBufferSubState::CommandBufferSubState(SyncValidator &dev, vvl::CommandBuf
 void CommandBufferSubState::End() {
     // For threads that are dedicated to recording command buffers but do not submit themselves,
     // the end of recording is a logical point to update memory stats
-    access_context.GetSyncState().stats.UpdateMemoryStats();
+    syncval_stats::Stats &stats = access_context.GetSyncState().stats;
+    stats.UpdateMemoryStats();
+    stats.UpdateCommandBufferAccessMapSize(access_context.GetCurrentAccessContext()->GetAccessStateMap().size());
+    access_context.BuildFirstUseSegments();
 }
 
 void CommandBufferSubState::Destroy() {
@@ -86,8 +86,9 @@ struct HandleRecord {
 // It's important to limit the size of this structure. Separate record is stored per access command.
 struct ResourceUsageRecord {
     static constexpr auto kMaxIndex = std::numeric_limits<ResourceUsageTag>::max();
-    enum class SubcommandType { kNone, kSubpassTransition, kLoadOp, kStoreOp, kResolveOp, kIndex };
+    enum class SubcommandType : uint8_t { kNone, kSubpassTransition, kLoadOp, kStoreOp, kResolveOp, kIndex };
 
+    ResourceUsageRecord() = default;
     ResourceUsageRecord(vvl::Func command, uint32_t seq_num, SubcommandType sub_type, const vvl::CommandBuffer *cb_state,
                         uint32_t reset_count)
         : command(command), seq_num(seq_num), sub_command_type(sub_type), cb_state(cb_state), reset_count(reset_count) {}
@@ -114,6 +115,55 @@ struct ResourceUsageRecord {
     AlternateResourceUsage alt_usage;
 };
 
+// Storage for the ResourceUsageRecords of a command buffer or a queue batch, indexed by tag.
+// The per command fields are kept in a compact entry array. The command buffer and its reset count only change where the
+// records of an executed secondary command buffer start or end, so they are stored once per run of records. Alternate usages
+// (present, acquire) are rare and kept on the side. A full ResourceUsageRecord is only assembled by GetRecord, which is
+// needed when an error message is formatted.
+class ResourceUsageLog {
+  public:
+    struct Entry {
+        vvl::Func command = vvl::Func::Empty;
+        uint32_t seq_num = 0;
+        uint32_t first_handle_index = vvl::kNoIndex32;
+        uint32_t handle_count = 0;
+        uint32_t label_command_index = vvl::kNoIndex32;
+        ResourceUsageRecord::SubcommandType sub_command_type = ResourceUsageRecord::SubcommandType::kNone;
+    };
+
+    Entry &Add(vvl::Func command, uint32_t seq_num, ResourceUsageRecord::SubcommandType sub_type,
+               const vvl::CommandBuffer *cb_state, uint32_t reset_count);
+    void AddAlternateUsage(const AlternateResourceUsage::RecordBase &usage);
+    void Append(const ResourceUsageLog &other);
+    void Reserve(size_t count) { entries_.reserve(count); }
+
+    size_t Size() const { return entries_.size(); }
+    bool Empty() const { return entries_.empty(); }
+    Entry &GetEntry(size_t index) {
+        assert(index < entries_.size());
+        return entries_[index];
+    }
+    const Entry &GetEntry(size_t index) const {
+        assert(index < entries_.size());
+        return entries_[index];
+    }
+    const Entry &Back() const { return GetEntry(entries_.size() - 1); }
+    ResourceUsageRecord GetRecord(size_t index) const;
+
+  private:
+    // Records starting at first_index (up to the next run) belong to cb_state with reset_count
+    struct CommandBufferRun {
+        uint32_t first_index;
+        uint32_t reset_count;
+        const vvl::CommandBuffer *cb_state;
+    };
+    void AddToRun(const vvl::CommandBuffer *cb_state, uint32_t reset_count);
+
+    std::vector<Entry> entries_;
+    std::vector<CommandBufferRun> runs_;
+    std::vector<std::pair<uint32_t, AlternateResourceUsage>> alternate_usages_;
+};
+
 // ResourceUsageInfo is similar to ResourceUsageRecord but prioritizes accessibility over memory efficiency.
 // This structure can be as large as needed. Instances are usually stored on the stack.
 struct ResourceUsageInfo {
@@ -141,7 +191,7 @@ struct DebugNameProvider {
 // Command execution context is the base class for command buffer and queue contexts
 class CommandExecutionContext {
   public:
-    using AccessLog = std::vector<ResourceUsageRecord>;
+    using AccessLog = ResourceUsageLog;
     using CommandBufferSet = std::vector<std::shared_ptr<const vvl::CommandBuffer>>;
     CommandExecutionContext(const SyncValidator &sync_validator, VkQueueFlags queue_flags);
     virtual ~CommandExecutionContext() = default;
@@ -240,7 +290,7 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     void RecordExecutedCommandBuffer(const CommandBufferAccessContext &recorded_context);
     void ResolveExecutedCommandBuffer(const AccessContext &recorded_context, ResourceUsageTag offset);
 
-    size_t GetTagCount() const { return access_log_->size(); }
+    size_t GetTagCount() const { return access_log_->Size(); }
     VulkanTypedHandle Handle() const override {
         if (cb_state_) {
             return cb_state_->Handle();
@@ -279,6 +329,14 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     void ImportRecordedAccessLog(const CommandBufferAccessContext &cb_context);
     const std::vector<SyncOpEntry> &GetSyncOps() const { return sync_ops_; };
 
+    // Entries of the recorded access context with first accesses before sync op i (or after the last sync op for the last
+    // segment). The recorded accesses don't change until the command buffer is reset, so this is built once when recording
+    // ends and every replay of the command buffer reuses it instead of scanning the whole access map for each segment.
+    using FirstUseSegment = std::vector<const ResourceAccessRangeMap::value_type *>;
+    void BuildFirstUseSegments();
+    // Returns null when the segments weren't built for recorded_context (ex. replaying a render pass subpass context)
+    const FirstUseSegment *GetFirstUseSegment(const AccessContext *recorded_context, size_t segment) const;
+
     // DebugNameProvider
     std::string GetDebugRegionName(const ResourceUsageRecord &record) const override;
 
@@ -302,6 +360,34 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
 
     void CheckCommandTagDebugCheckpoint();
 
+    // Statically used descriptor of the bound pipeline, resolved against the bound descriptor sets
+    struct DescriptorAccess {
+        const vvl::Descriptor *descriptor = nullptr;
+        const vvl::DescriptorSet *descriptor_set = nullptr;
+        VkDescriptorType descriptor_type = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+        SyncAccessIndex sync_index = SYNC_ACCESS_INDEX_NONE;
+        VkShaderStageFlagBits stage = VK_SHADER_STAGE_FLAG_BITS_MAX_ENUM;
+        uint32_t set = 0;
+        uint32_t binding = 0;
+        uint32_t index = 0;
+        VkDeviceSize dynamic_offset = 0;
+    };
+    // Consecutive draws usually share the pipeline and the bound descriptor sets. The descriptor access list of the last
+    // draw is kept per bind point and reused while the pipeline, the bound sets, their contents (change count) and the
+    // dynamic offsets stay the same. The references keep the cached objects alive so a new object can't take the address.
+    struct DescriptorAccessCache {
+        struct BoundSet {
+            std::shared_ptr<vvl::DescriptorSet> set;
+            uint64_t change_count;
+            std::vector<uint32_t> dynamic_offsets;
+        };
+        std::shared_ptr<const vvl::Pipeline> pipeline;
+        std::vector<BoundSet> sets;
+        std::vector<DescriptorAccess> accesses;
+    };
+    // Requires a bound pipeline
+    const std::vector<DescriptorAccess> &GetDescriptorAccesses(VkPipelineBindPoint pipelineBindPoint) const;
+
   private:
     // Note: since every CommandBufferAccessContext is encapsulated in its CommandBuffer object,
     // a reference count is not needed here.
@@ -327,11 +413,16 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     std::vector<std::unique_ptr<RenderPassAccessContext>> render_pass_contexts_;
     RenderPassAccessContext *current_renderpass_context_;
     std::vector<SyncOpEntry> sync_ops_;
+    std::vector<FirstUseSegment> first_use_segments_;
+    const AccessContext *first_use_context_ = nullptr;
 
     // State during dynamic rendering (dynamic rendering rendering passes must be
     // contained within a single command buffer)
     std::unique_ptr<syncval_state::DynamicRenderingInfo> dynamic_rendering_info_;
 
+    // Built during validation of a draw/dispatch, which is const
+    mutable std::array<DescriptorAccessCache, vvl::BindPointCount> descriptor_access_cache_;
+
     // Secondary buffer validation uses proxy context and does local update (imitates Record).
     // Because in this case PreRecord is not called, the label state is not updated. We make
     // a copy of label state to update it locally together with proxy context.
@@ -1174,26 +1174,43 @@ bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range
 
         const HazardResult hazard = access_context->DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
                                                                          *exec_context_.GetCurrentAccessContext());
-        if (hazard.IsHazard()) {
-            const SyncValidator &sync_state = exec_context_.GetSyncState();
-            LogObjectList objlist(exec_context_.Handle(), recorded_context_.Handle());
-            const std::string error = sync_state.error_messages_.FirstUseError(hazard, exec_context_, recorded_context_, index_);
-            skip |= sync_state.SyncError(hazard.Hazard(), objlist, error_obj_.location, error);
-        }
+        skip |= ReportFirstUseHazard(hazard);
     }
     return skip;
 }
 
+bool ReplayState::DetectSegmentFirstUseHazard(const ResourceUsageRange &first_use_range, size_t segment) const {
+    if (!first_use_range.non_empty()) return false;
+
+    const AccessContext *access_context = GetRecordedAccessContext();
+    const auto *recorded_accesses = recorded_context_.GetFirstUseSegment(access_context, segment);
+    if (!recorded_accesses) {
+        return DetectFirstUseHazard(first_use_range);
+    }
+    const HazardResult hazard = AccessContext::DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
+                                                                    *exec_context_.GetCurrentAccessContext(), *recorded_accesses);
+    return ReportFirstUseHazard(hazard);
+}
+
+bool ReplayState::ReportFirstUseHazard(const HazardResult &hazard) const {
+    if (!hazard.IsHazard()) return false;
+    const SyncValidator &sync_state = exec_context_.GetSyncState();
+    LogObjectList objlist(exec_context_.Handle(), recorded_context_.Handle());
+    const std::string error = sync_state.error_messages_.FirstUseError(hazard, exec_context_, recorded_context_, index_);
+    return sync_state.SyncError(hazard.Hazard(), objlist, error_obj_.location, error);
+}
+
 bool ReplayState::ValidateFirstUse() {
     if (!exec_context_.ValidForSyncOps()) return false;
 
     bool skip = false;
     ResourceUsageRange first_use_range = {0, 0};
+    size_t segment = 0;
 
     for (const auto &sync_op : recorded_context_.GetSyncOps()) {
         // Set the range to cover all accesses until the next sync_op, and validate
         first_use_range.end = sync_op.tag;
-        skip |= DetectFirstUseHazard(first_use_range);
+        skip |= DetectSegmentFirstUseHazard(first_use_range, segment++);
 
         // Call to replay validate support for syncop with non-trivial replay
         skip |= sync_op.sync_op->ReplayValidate(*this, sync_op.tag);
@@ -1205,7 +1222,7 @@ bool ReplayState::ValidateFirstUse() {
 
     // and anything after the last syncop
     first_use_range.end = ResourceUsageRecord::kMaxIndex;
-    skip |= DetectFirstUseHazard(first_use_range);
+    skip |= DetectSegmentFirstUseHazard(first_use_range, segment);
 
     return skip;
 }
@@ -407,6 +407,8 @@ class ReplayState {
 
     bool ValidateFirstUse();
     bool DetectFirstUseHazard(const ResourceUsageRange &first_use_range) const;
+    // Reports a first use hazard that was detected ahead of the replay
+    bool ReportFirstUseHazard(const HazardResult &hazard) const;
 
     ReplayState(CommandExecutionContext &exec_context, const CommandBufferAccessContext &recorded_context,
                 const ErrorObject &error_object, uint32_t index, ResourceUsageTag base_tag);
@@ -421,6 +423,7 @@ class ReplayState {
 
   protected:
     const AccessContext *GetRecordedAccessContext() const;
+    bool DetectSegmentFirstUseHazard(const ResourceUsageRange &first_use_range, size_t segment) const;
 
     CommandExecutionContext &exec_context_;
     const CommandBufferAccessContext &recorded_context_;
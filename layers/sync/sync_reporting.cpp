@@ -630,7 +630,7 @@ static ResourceUsageInfo GetResourceUsageInfoFromRecord(ResourceUsageTagEx tag_e
 }
 
 ResourceUsageInfo CommandBufferAccessContext::GetResourceUsageInfo(ResourceUsageTagEx tag_ex) const {
-    const ResourceUsageRecord &record = (*access_log_)[tag_ex.tag];
+    const ResourceUsageRecord record = access_log_->GetRecord(tag_ex.tag);
     const auto debug_name_provider = (record.label_command_index == vvl::kU32Max) ? nullptr : this;
     return GetResourceUsageInfoFromRecord(tag_ex, record, debug_name_provider);
 }
@@ -640,8 +640,7 @@ ResourceUsageInfo QueueBatchContext::GetResourceUsageInfo(ResourceUsageTagEx tag
     if (!access.IsValid()) {
         return {};
     }
-    const ResourceUsageRecord &record = *access.record;
-    ResourceUsageInfo info = GetResourceUsageInfoFromRecord(tag_ex, record, access.debug_name_provider);
+    ResourceUsageInfo info = GetResourceUsageInfoFromRecord(tag_ex, access.record, access.debug_name_provider);
 
     const BatchAccessLog::BatchRecord &batch = *access.batch;
     if (batch.queue) {
@@ -21,4 +21,9 @@ struct SyncValSettings {
     bool submit_time_validation = true;
     bool shader_accesses_heuristic = false;
     bool message_extra_properties = false;
+    // Limit in MiB for the batches kept alive only by semaphore signals, zero means no limit
+    uint32_t retained_memory_limit = 0;
+    bool stats = false;
+    // Print stats every N queue submissions, zero means only at device destruction
+    uint32_t stats_report_period = 0;
 };
@@ -16,11 +16,11 @@
  */
 
 #include "sync_stats.h"
-
-#if VVL_ENABLE_SYNCVAL_STATS != 0
 #include "sync_commandbuffer.h"
 
 #include <iostream>
+#include <iterator>
+#include <sstream>
 
 namespace vvl {
 // Until C++ 26 std::atomic<T>::fetch_max arrives
@@ -28,8 +28,8 @@ namespace vvl {
 // https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2024/p0493r5.pdf
 template <typename T>
 inline T atomic_fetch_max(std::atomic<T> &current_max, const T &value) noexcept {
-    T t = current_max.load();
-    while (!current_max.compare_exchange_weak(t, std::max(t, value)))
+    T t = current_max.load(std::memory_order_relaxed);
+    while (t < value && !current_max.compare_exchange_weak(t, value, std::memory_order_relaxed))
         ;
     return t;
 }
@@ -39,15 +39,15 @@ namespace syncval_stats {
 
 // NOTE: fetch_add/fetch_sub return value before increment/decrement.
 // Our Add/Sub functions return new counter values, so they need to
-// adjust result of the atomic function by adding/subtracting one.
+// adjust result of the atomic function by adding/subtracting n.
 
-void Value32::Update(uint32_t new_value) { u32.store(new_value); }
-uint32_t Value32::Add(uint32_t n) { return u32.fetch_add(n) + 1; }
-uint32_t Value32::Sub(uint32_t n) { return u32.fetch_sub(n) - 1; }
+void Value32::Update(uint32_t new_value) { u32.store(new_value, std::memory_order_relaxed); }
+uint32_t Value32::Add(uint32_t n) { return u32.fetch_add(n, std::memory_order_relaxed) + n; }
+uint32_t Value32::Sub(uint32_t n) { return u32.fetch_sub(n, std::memory_order_relaxed) - n; }
 
-void Value64::Update(uint64_t new_value) { u64.store(new_value); }
-uint64_t Value64::Add(uint64_t n) { return u64.fetch_add(n) + 1; }
-uint64_t Value64::Sub(uint64_t n) { return u64.fetch_sub(n) - 1; }
+void Value64::Update(uint64_t new_value) { u64.store(new_value, std::memory_order_relaxed); }
+uint64_t Value64::Add(uint64_t n) { return u64.fetch_add(n, std::memory_order_relaxed) + n; }
+uint64_t Value64::Sub(uint64_t n) { return u64.fetch_sub(n, std::memory_order_relaxed) - n; }
 
 void ValueMax32::Update(uint32_t new_value) {
     value.Update(new_value);
@@ -69,6 +69,12 @@ void ValueMax64::Add(uint64_t n) {
 }
 void ValueMax64::Sub(uint64_t n) { value.Sub(n); }
 
+void TimerValue::Add(uint64_t ns) {
+    count.Add(1);
+    total_ns.Add(ns);
+    vvl::atomic_fetch_max(max_ns.u64, ns);
+}
+
 Stats::~Stats() {
     if (report_on_destruction) {
         const std::string report = CreateReport();
@@ -76,23 +82,65 @@ Stats::~Stats() {
     }
 }
 
-void Stats::AddCommandBufferContext() { command_buffer_context_counter.Add(1); }
-void Stats::RemoveCommandBufferContext() { command_buffer_context_counter.Sub(1); }
+void Stats::AddCommandBufferContext() {
+    if (enabled) command_buffer_context_counter.Add(1);
+}
+void Stats::RemoveCommandBufferContext() {
+    if (enabled) command_buffer_context_counter.Sub(1);
+}
 
-void Stats::AddQueueBatchContext() { queue_batch_context_counter.Add(1); }
-void Stats::RemoveQueueBatchContext() { queue_batch_context_counter.Sub(1); }
+void Stats::AddQueueBatchContext() {
+    if (enabled) queue_batch_context_counter.Add(1);
+}
+void Stats::RemoveQueueBatchContext() {
+    if (enabled) queue_batch_context_counter.Sub(1);
+}
 
-void Stats::AddTimelineSignals(uint32_t count) { timeline_signal_counter.Add(count); }
-void Stats::RemoveTimelineSignals(uint32_t count) { timeline_signal_counter.Sub(count); }
+void Stats::AddTimelineSignals(uint32_t count) {
+    if (enabled) timeline_signal_counter.Add(count);
+}
+void Stats::RemoveTimelineSignals(uint32_t count) {
+    if (enabled) timeline_signal_counter.Sub(count);
+}
 
-void Stats::AddUnresolvedBatch() { unresolved_batch_counter.Add(1); }
-void Stats::RemoveUnresolvedBatch() { unresolved_batch_counter.Sub(1); }
+void Stats::AddUnresolvedBatch() {
+    if (enabled) unresolved_batch_counter.Add(1);
+}
+void Stats::RemoveUnresolvedBatch() {
+    if (enabled) unresolved_batch_counter.Sub(1);
+}
 
-void Stats::AddHandleRecord(uint32_t count) { handle_record_counter.Add(count); }
-void Stats::RemoveHandleRecord(uint32_t count) { handle_record_counter.Sub(count); }
+void Stats::AddHandleRecord(uint32_t count) {
+    if (enabled) handle_record_counter.Add(count);
+}
+void Stats::RemoveHandleRecord(uint32_t count) {
+    if (enabled) handle_record_counter.Sub(count);
+}
+
+void Stats::UpdateCommandBufferAccessMapSize(uint64_t size) {
+    if (enabled) command_buffer_access_map_size.Update(size);
+}
+void Stats::UpdateBatchAccessMapSize(uint64_t size) {
+    if (enabled) batch_access_map_size.Update(size);
+}
+
+void Stats::AddParallelReplayCommandBuffers(uint32_t count) {
+    if (enabled) parallel_replay_command_buffers.Add(count);
+}
+
+void Stats::AddTime(Timer timer, uint64_t ns) {
+    if (enabled) timers[static_cast<uint32_t>(timer)].Add(ns);
+}
+
+bool Stats::AddSubmit() {
+    if (!enabled) return false;
+    const uint64_t submit_count = submit_counter.Add(1);
+    return report_period != 0 && (submit_count % report_period) == 0;
+}
 
 void Stats::UpdateMemoryStats() {
 #if defined(USE_MIMALLOC_STATS)
+    if (!enabled) return;
     mi_stats_merge();
     {
         std::unique_lock<std::mutex> lock(mi_stats_mutex);
@@ -104,6 +152,9 @@ void Stats::UpdateMemoryStats() {
 void Stats::ReportOnDestruction() { report_on_destruction = true; }
 
 std::string Stats::CreateReport() {
+    if (!enabled) {
+        return "SyncVal stats are disabled, use syncval_stats setting to enable them\n";
+    }
     std::ostringstream str;
     {
         uint32_t cb_contex = command_buffer_context_counter.value.u32;
@@ -144,6 +195,29 @@ std::string Stats::CreateReport() {
         str << "\tmax_count = " << handle_record_max << '\n';
         str << "\tmax_memory = " << handle_record_max_memory << " bytes\n";
     }
+    {
+        str << "Access map entries:\n";
+        str << "\tcommand_buffer = " << command_buffer_access_map_size.value.u64 << '\n';
+        str << "\tcommand_buffer_max = " << command_buffer_access_map_size.max_value.u64 << '\n';
+        str << "\tbatch = " << batch_access_map_size.value.u64 << '\n';
+        str << "\tbatch_max = " << batch_access_map_size.max_value.u64 << '\n';
+    }
+    {
+        str << "Submit replay:\n";
+        str << "\tparallel_command_buffers = " << parallel_replay_command_buffers.u64 << '\n';
+    }
+    {
+        static constexpr const char *timer_names[] = {"submit_replay", "submit_resolve", "submit_record", "batch_trim"};
+        static_assert(std::size(timer_names) == static_cast<size_t>(Timer::kCount));
+        str << "Timers (submissions = " << submit_counter.u64 << "):\n";
+        for (uint32_t i = 0; i < static_cast<uint32_t>(Timer::kCount); i++) {
+            const uint64_t count = timers[i].count.u64;
+            const uint64_t total_us = timers[i].total_ns.u64 / 1000;
+            const uint64_t max_us = timers[i].max_ns.u64 / 1000;
+            str << '\t' << timer_names[i] << ": count = " << count << ", total = " << total_us << " us, max = " << max_us
+                << " us\n";
+        }
+    }
 
 #if defined(USE_MIMALLOC_STATS)
     mi_stats_print_out([](const char* msg, void* arg) { *static_cast<std::ostringstream*>(arg) << msg; }, &str);
@@ -155,4 +229,3 @@ std::string Stats::CreateReport() {
 }
 
 }  // namespace syncval_stats
-#endif  // VVL_ENABLE_SYNCVAL_STATS != 0
@@ -17,16 +17,18 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <cstdint>
 
+// Compile time switch that turns on stats collection regardless of the syncval_stats setting.
+// Required to collect mimalloc stats, since those also need a mimalloc build with MI_STAT=1.
 #ifndef VVL_ENABLE_SYNCVAL_STATS
 #define VVL_ENABLE_SYNCVAL_STATS 0
 #endif
 
 #if VVL_ENABLE_SYNCVAL_STATS != 0
-#include <atomic>
-
 // NOTE: mimalloc should be built with MI_STAT=1 to enable stats module
 #if defined(USE_MIMALLOC)
 #include <mimalloc.h>
@@ -40,17 +42,17 @@
 #endif  // VVL_ENABLE_SYNCVAL_STATS != 0
 
 namespace syncval_stats {
-#if VVL_ENABLE_SYNCVAL_STATS != 0
 
+// Counters only use relaxed atomics. They are independent of each other, and the report is a best effort snapshot.
 struct Value32 {
-    std::atomic_uint32_t u32;
+    std::atomic_uint32_t u32{0};
     void Update(uint32_t new_value);
     uint32_t Add(uint32_t n);  // Returns new counter value
     uint32_t Sub(uint32_t n);  // Returns new counter value
 };
 
 struct Value64 {
-    std::atomic_uint64_t u64;
+    std::atomic_uint64_t u64{0};
     void Update(uint64_t new_value);
     uint64_t Add(uint64_t n);  // Returns new counter value
     uint64_t Sub(uint64_t n);  // Returns new counter value
@@ -72,9 +74,30 @@ struct ValueMax64 {
     void Sub(uint64_t n);
 };
 
+enum class Timer {
+    kSubmitReplay,   // Hazard detection of the submitted command buffers against the queue state
+    kSubmitResolve,  // Merge of the submitted command buffer accesses into the batch
+    kSubmitRecord,   // Record phase of the submission (signals and pending batches update)
+    kBatchTrim,      // Batch cleanup after the submission is resolved
+    kCount
+};
+
+struct TimerValue {
+    Value64 count;
+    Value64 total_ns;
+    Value64 max_ns;
+    void Add(uint64_t ns);
+};
+
 struct Stats {
     ~Stats();
+    // Collection is off until enabled at device creation, before any of the counters can be touched
+    void Enable() { enabled = true; }
+    bool IsEnabled() const { return enabled; }
+    bool enabled = VVL_ENABLE_SYNCVAL_STATS != 0;
     bool report_on_destruction = false;
+    // Report every N queue submissions, zero disables periodic reports
+    uint32_t report_period = 0;
 
 #if defined(USE_MIMALLOC_STATS)
     mi_stats_t mi_stats;
@@ -101,27 +124,49 @@ struct Stats {
     void AddHandleRecord(uint32_t count = 1);
     void RemoveHandleRecord(uint32_t count = 1);
 
+    // Access map entry counts of the last finished command buffer / trimmed batch
+    ValueMax64 command_buffer_access_map_size;
+    ValueMax64 batch_access_map_size;
+    void UpdateCommandBufferAccessMapSize(uint64_t size);
+    void UpdateBatchAccessMapSize(uint64_t size);
+
+    // Command buffers whose first use hazards were detected on the worker pool ahead of the submit replay
+    Value64 parallel_replay_command_buffers;
+    void AddParallelReplayCommandBuffers(uint32_t count);
+
+    TimerValue timers[static_cast<uint32_t>(Timer::kCount)];
+    void AddTime(Timer timer, uint64_t ns);
+
+    Value64 submit_counter;
+    // Returns true when a periodic report is due
+    bool AddSubmit();
+
     void UpdateMemoryStats();
     void ReportOnDestruction();
     std::string CreateReport();
 };
 
-#else
-struct Stats {
-    void AddHandleRecord(uint32_t count = 1) {}
-    void RemoveHandleRecord(uint32_t count = 1) {}
-    void AddCommandBufferContext() {}
-    void RemoveCommandBufferContext() {}
-    void AddQueueBatchContext() {}
-    void RemoveQueueBatchContext() {}
-    void AddTimelineSignals(uint32_t count) {}
-    void RemoveTimelineSignals(uint32_t count) {}
-    void AddUnresolvedBatch() {}
-    void RemoveUnresolvedBatch() {}
-
-    void UpdateMemoryStats() {}
-    void ReportOnDestruction() {}
-    std::string CreateReport() { return "SyncVal stats are disabled in the current build configuration\n"; }
+// Adds the lifetime of the object to the timer. Does not read the clock when stats are disabled.
+class ScopedTimer {
+  public:
+    ScopedTimer(Stats &stats, Timer timer) : stats_(stats.IsEnabled() ? &stats : nullptr), timer_(timer) {
+        if (stats_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+    ~ScopedTimer() {
+        if (stats_) {
+            const auto duration = std::chrono::steady_clock::now() - start_;
+            stats_->AddTime(timer_, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+        }
+    }
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+  private:
+    Stats *stats_;
+    Timer timer_;
+    std::chrono::steady_clock::time_point start_;
 };
-#endif  // VVL_ENABLE_SYNCVAL_STATS != 0
+
 }  // namespace syncval_stats
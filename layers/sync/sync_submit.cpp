@@ -19,6 +19,7 @@
 #include "sync/sync_validation.h"
 #include "sync/sync_image.h"
 #include "sync/sync_reporting.h"
+#include "containers/range_set.h"
 
 AcquiredImage::AcquiredImage(const PresentedImage& presented, ResourceUsageTag acq_tag)
     : image(presented.image), generator(presented.range_gen), present_tag(presented.tag), acquire_tag(acq_tag) {}
@@ -263,20 +264,42 @@ QueueBatchContext::QueueBatchContext(const SyncValidator& sync_state)
 QueueBatchContext::~QueueBatchContext() { sync_state_.stats.RemoveQueueBatchContext(); }
 
 void QueueBatchContext::Trim() {
+    syncval_stats::ScopedTimer timer(sync_state_.stats, syncval_stats::Timer::kBatchTrim);
     // Clean up unneeded access context contents and log information
-    access_context_.TrimAndClearFirstAccess();
+    vvl::WorkerPool& worker_pool = sync_state_.device_state->worker_pool_;
+    access_context_.TrimAndClearFirstAccess(worker_pool);
 
     ResourceUsageTagSet used_tags;
-    access_context_.AddReferencedTags(used_tags);
+    access_context_.AddReferencedTags(used_tags, worker_pool);
 
     // Note: AccessContexts in the SyncEventsState are trimmed when created.
     events_context_.AddReferencedTags(used_tags);
 
     // Only conserve AccessLog references that are referenced by used_tags
     batch_log_.Trim(used_tags);
+
+    sync_state_.stats.UpdateBatchAccessMapSize(access_context_.GetAccessStateMap().size());
+}
+
+size_t QueueBatchContext::EstimateMemoryUsage() const {
+    const ResourceAccessRangeMap& accesses = access_context_.GetAccessStateMap();
+    // Map node: the entry plus the tree links. Read lists that spill out of the small vectors are not counted.
+    constexpr size_t kAccessNodeSize = sizeof(ResourceAccessRangeMap::value_type) + 4 * sizeof(void*);
+    // A pooled map keeps the memory of its erased nodes until it is destroyed, so it holds at least its pool
+    const size_t access_map_memory = std::max(accesses.size() * kAccessNodeSize, accesses.get_allocator().PoolMemory());
+    return access_map_memory + batch_log_.EstimateMemoryUsage();
+}
+
+void QueueBatchContext::Collapse() {
+    // Clearing the map would keep its nodes in the pool, a new map gives the memory back
+    access_context_.GetAccessStateMap() = ResourceAccessRangeMap();
+    events_context_.Clear();
+    batch_log_.Clear();
+    collapsed_ = true;
 }
 
 void QueueBatchContext::ResolveSubmittedCommandBuffer(const AccessContext& recorded_context, ResourceUsageTag offset) {
+    syncval_stats::ScopedTimer timer(sync_state_.stats, syncval_stats::Timer::kSubmitResolve);
     GetCurrentAccessContext()->ResolveFromContext(QueueTagOffsetBarrierAction(GetQueueId(), offset), recorded_context);
 }
 
@@ -336,6 +359,10 @@ void QueueBatchContext::EndRenderPassReplayCleanup(ReplayState& replay) {
 
 void QueueBatchContext::ResolvePresentSemaphoreWait(const SignalInfo& signal_info, const PresentedImages& presented_images) {
     assert(signal_info.batch);
+    if (signal_info.batch->IsCollapsed()) {
+        collapsed_wait_tag_ = std::max(collapsed_wait_tag_, signal_info.batch->tag_range_.end);
+        return;
+    }
 
     const AccessContext& from_context = signal_info.batch->access_context_;
     const SemaphoreScope& signal_scope = signal_info.first_scope;
@@ -374,6 +401,10 @@ void QueueBatchContext::ResolvePresentSemaphoreWait(const SignalInfo& signal_inf
 
 void QueueBatchContext::ResolveSubmitSemaphoreWait(const SignalInfo& signal_info, VkPipelineStageFlags2 wait_mask) {
     assert(signal_info.batch);
+    if (signal_info.batch->IsCollapsed()) {
+        collapsed_wait_tag_ = std::max(collapsed_wait_tag_, signal_info.batch->tag_range_.end);
+        return;
+    }
 
     const SemaphoreScope& signal_scope = signal_info.first_scope;
     const auto queue_flags = queue_state_->GetQueueFlags();
@@ -404,6 +435,19 @@ void QueueBatchContext::ResolveSubmitSemaphoreWait(const SignalInfo& signal_info
     }
 }
 
+// The semaphore barrier of a wait on a collapsed batch can't be applied, the accesses it would make visible are gone. Copies
+// of those accesses can still reach this batch through the other batches it imports (ex. the previous batch on the queue
+// imported the signaling batch in submission order), and without the barrier they would be reported as hazards. So the wait
+// is widened to a full wait on everything before the end of the collapsed batch, on any queue. This can hide real hazards
+// against those older accesses, which is the price of syncval_retained_memory_limit.
+void QueueBatchContext::ApplyCollapsedSignalWaits() {
+    if (collapsed_wait_tag_ == 0) {
+        return;
+    }
+    ApplyTaggedWait(kQueueAny, collapsed_wait_tag_);
+    collapsed_wait_tag_ = 0;
+}
+
 void QueueBatchContext::ResolveLastBatch(const QueueBatchContext::ConstPtr& last_batch) {
     // Copy in the event state from the previous batch (on this queue)
     events_context_.DeepCopy(last_batch->events_context_);
@@ -484,10 +528,10 @@ void QueueBatchContext::LogPresentOperations(const PresentedImages& presented_im
         batch.submit_index = submit_index;
         batch.base_tag = tag_range_.begin;
         batch_log_.Insert(batch, tag_range_, access_log);
-        access_log->reserve(tag_range_.size());
+        access_log->Reserve(tag_range_.size());
         assert(tag_range_.size() == presented_images.size());
         for (const auto& presented : presented_images) {
-            access_log->emplace_back(PresentResourceRecord(static_cast<const PresentedImageRecord>(presented)));
+            access_log->AddAlternateUsage(PresentResourceRecord(static_cast<const PresentedImageRecord>(presented)));
         }
     }
 }
@@ -502,7 +546,7 @@ void QueueBatchContext::LogAcquireOperation(const PresentedImage& presented, vvl
     BatchAccessLog::BatchRecord batch{queue_state_};
     batch.base_tag = tag_range_.begin;
     batch_log_.Insert(batch, tag_range_, access_log);
-    access_log->emplace_back(AcquireResourceRecord(presented, tag_range_.begin, command));
+    access_log->AddAlternateUsage(AcquireResourceRecord(presented, tag_range_.begin, command));
 }
 
 void QueueBatchContext::SetupAccessContext(const PresentedImage& presented) {
@@ -629,12 +673,26 @@ bool QueueBatchContext::ValidateSubmit(const std::vector<CommandBufferConstPtr>&
     }
     batch.base_tag = SetupBatchTags(tag_count);
 
+    std::vector<uint8_t> detected;
+    std::vector<HazardResult> detected_hazards;
+    {
+        syncval_stats::ScopedTimer timer(sync_state_.stats, syncval_stats::Timer::kSubmitReplay);
+        DetectIndependentFirstUseHazards(command_buffers, detected, detected_hazards);
+    }
+
     for (size_t index = 0; index < command_buffers.size(); index++) {
         const auto& cb = syncval_state::SubState(*command_buffers[index]);
         // Validate and resolve command buffers that has tagged commands
         const CommandBufferAccessContext& access_context = cb.access_context;
         if (access_context.GetTagCount() > 0) {
-            skip |= ReplayState(*this, access_context, error_obj, uint32_t(index), batch.base_tag).ValidateFirstUse();
+            ReplayState replay(*this, access_context, error_obj, uint32_t(index), batch.base_tag);
+            if (!detected.empty() && detected[index]) {
+                // Reported here rather than on the worker thread so the messages keep submission order
+                skip |= replay.ReportFirstUseHazard(detected_hazards[index]);
+            } else {
+                syncval_stats::ScopedTimer timer(sync_state_.stats, syncval_stats::Timer::kSubmitReplay);
+                skip |= replay.ValidateFirstUse();
+            }
             // The barriers have already been applied in ValidatFirstUse
             batch_log_.Import(batch, access_context, current_label_stack);
             ResolveSubmittedCommandBuffer(*access_context.GetCurrentAccessContext(), batch.base_tag);
@@ -647,6 +705,71 @@ bool QueueBatchContext::ValidateSubmit(const std::vector<CommandBufferConstPtr>&
     return skip;
 }
 
+// Replay of command buffer N sees the batch state left by resolving command buffers 0..N-1. When a command buffer has no sync
+// operations and none of its accesses overlap the accesses of the command buffers before it, that state is the same as the
+// state before the batch for every range it looks at, so its first use hazards can be detected up front on the worker pool.
+// Recorded barriers are applied to the whole batch context, so nothing past the first command buffer with sync operations
+// qualifies. The resolve of every command buffer still happens in submission order.
+void QueueBatchContext::DetectIndependentFirstUseHazards(const std::vector<CommandBufferConstPtr>& command_buffers,
+                                                         std::vector<uint8_t>& detected,
+                                                         std::vector<HazardResult>& hazards) const {
+    if (command_buffers.size() < kParallelReplayThreshold || !ValidForSyncOps()) return;
+
+    // Count the candidates first, this is cheap compared to collecting their ranges
+    size_t candidate_end = 0;
+    size_t candidate_count = 0;
+    for (; candidate_end < command_buffers.size(); candidate_end++) {
+        const CommandBufferAccessContext& cb_context = syncval_state::SubState(*command_buffers[candidate_end]).access_context;
+        if (cb_context.GetTagCount() == 0) continue;
+        if (!cb_context.GetSyncOps().empty()) break;
+        candidate_count++;
+    }
+    if (candidate_count < kParallelReplayThreshold) return;
+
+    std::vector<uint32_t> independent;
+    vvl::range_set<ResourceAddress> batch_ranges;
+    for (size_t index = 0; index < candidate_end; index++) {
+        const CommandBufferAccessContext& cb_context = syncval_state::SubState(*command_buffers[index]).access_context;
+        if (cb_context.GetTagCount() == 0) continue;
+        candidate_count--;
+
+        const ResourceAccessRangeMap& accesses = cb_context.GetCurrentAccessContext()->GetAccessStateMap();
+        const bool overlaps = std::any_of(accesses.begin(), accesses.end(),
+                                          [&batch_ranges](const auto& entry) { return batch_ranges.intersects(entry.first); });
+        if (!overlaps) {
+            independent.emplace_back(static_cast<uint32_t>(index));
+        }
+        if (independent.size() + candidate_count < kParallelReplayThreshold) return;
+        if (candidate_count == 0) break;
+
+        // The map is sorted, so the ranges of one command buffer append to their own set and then merge in linear time
+        vvl::range_set<ResourceAddress> cb_ranges;
+        for (const auto& entry : accesses) {
+            cb_ranges.insert(entry.first);
+        }
+        batch_ranges.insert(cb_ranges);
+    }
+    if (independent.size() < kParallelReplayThreshold) return;
+    sync_state_.stats.AddParallelReplayCommandBuffers(static_cast<uint32_t>(independent.size()));
+
+    detected.assign(command_buffers.size(), 0);
+    hazards.resize(command_buffers.size());
+    const AccessContext& batch_context = *GetCurrentAccessContext();
+    const QueueId queue_id = GetQueueId();
+    const ResourceUsageRange all_tags(0, ResourceUsageRecord::kMaxIndex);
+    sync_state_.device_state->worker_pool_.ParallelFor(static_cast<uint32_t>(independent.size()), [&](uint32_t i) {
+        const uint32_t index = independent[i];
+        const CommandBufferAccessContext& cb_context = syncval_state::SubState(*command_buffers[index]).access_context;
+        const AccessContext* recorded_context = cb_context.GetCurrentAccessContext();
+        if (const auto* recorded_accesses = cb_context.GetFirstUseSegment(recorded_context, 0)) {
+            hazards[index] = AccessContext::DetectFirstUseHazard(queue_id, all_tags, batch_context, *recorded_accesses);
+        } else {
+            hazards[index] = recorded_context->DetectFirstUseHazard(queue_id, all_tags, batch_context);
+        }
+        detected[index] = 1;
+    });
+}
+
 QueueBatchContext::PresentResourceRecord::Base_::Record QueueBatchContext::PresentResourceRecord::MakeRecord() const {
     return std::make_unique<PresentResourceRecord>(presented_);
 }
@@ -760,6 +883,15 @@ void BatchAccessLog::Insert(const BatchRecord& batch, const ResourceUsageRange&
     log_map_.insert(std::make_pair(range, CBSubmitLog(batch, nullptr, std::move(log))));
 }
 
+size_t BatchAccessLog::EstimateMemoryUsage() const {
+    // The logs can be shared with the command buffers, they are counted for every batch that holds on to them
+    size_t memory = 0;
+    for (const auto& [range, submit_log] : log_map_) {
+        memory += sizeof(CBSubmitLogRangeMap::value_type) + submit_log.Size() * sizeof(CommandExecutionContext::AccessLog::Entry);
+    }
+    return memory;
+}
+
 // Trim: Remove any unreferenced AccessLog ranges from a BatchAccessLog
 //
 // In order to contain memory growth in the AccessLog information regarding prior submitted command buffers,
@@ -834,10 +966,10 @@ BatchAccessLog::AccessRecord BatchAccessLog::CBSubmitLog::GetAccessRecord(Resour
     assert(tag >= batch_.base_tag);
     const size_t index = tag - batch_.base_tag;
     assert(log_);
-    assert(index < log_->size());
-    const ResourceUsageRecord* record = &(*log_)[index];
-    const auto debug_name_provider = (record->label_command_index == vvl::kU32Max) ? nullptr : this;
-    return AccessRecord{&batch_, record, debug_name_provider};
+    assert(index < log_->Size());
+    ResourceUsageRecord record = log_->GetRecord(index);
+    const auto debug_name_provider = (record.label_command_index == vvl::kU32Max) ? nullptr : this;
+    return AccessRecord{&batch_, std::move(record), debug_name_provider};
 }
 
 BatchAccessLog::CBSubmitLog::CBSubmitLog(const BatchRecord& batch,
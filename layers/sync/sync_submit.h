@@ -179,10 +179,10 @@ class BatchAccessLog {
     };
 
     struct AccessRecord {
-        const BatchRecord *batch;
-        const ResourceUsageRecord *record;
-        const DebugNameProvider *debug_name_provider;
-        bool IsValid() const { return batch && record; }
+        const BatchRecord *batch = nullptr;
+        ResourceUsageRecord record;
+        const DebugNameProvider *debug_name_provider = nullptr;
+        bool IsValid() const { return batch != nullptr; }
     };
 
     struct CBSubmitLog : DebugNameProvider {
@@ -196,7 +196,7 @@ class BatchAccessLog {
                     std::shared_ptr<const CommandExecutionContext::AccessLog> log);
         CBSubmitLog(const BatchRecord &batch, const CommandBufferAccessContext &cb,
                     const std::vector<std::string> &initial_label_stack);
-        size_t Size() const { return log_->size(); }
+        size_t Size() const { return log_->Size(); }
         AccessRecord GetAccessRecord(ResourceUsageTag tag) const;
 
         // DebugNameProvider
@@ -217,6 +217,9 @@ class BatchAccessLog {
                 std::shared_ptr<const CommandExecutionContext::AccessLog> log);
 
     void Trim(const ResourceUsageTagSet &used);
+    void Clear() { log_map_.clear(); }
+    // Rough estimate of the memory held by the logs of the batch
+    size_t EstimateMemoryUsage() const;
     // AccessRecord lookup is based on global tags
     AccessRecord GetAccessRecord(ResourceUsageTag tag) const;
     BatchAccessLog() {}
@@ -295,6 +298,15 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
     ~QueueBatchContext();
     void Trim();
 
+    // Rough estimate of the memory held by the batch accesses and access logs, used to enforce the retained memory limit
+    size_t EstimateMemoryUsage() const;
+    // Drops the accesses, events and access log of a batch that is only kept for semaphore waits. The tag range and queue
+    // sync tags are kept, so a wait on the batch still synchronizes with its queue, it just no longer imports the accesses.
+    // A wait on a collapsed batch is treated as a wait on everything before the end of the batch (see
+    // ApplyCollapsedSignalWaits), so hazards against older accesses can be missed, but no new hazards are reported.
+    void Collapse();
+    bool IsCollapsed() const { return collapsed_; }
+
     ResourceUsageInfo GetResourceUsageInfo(ResourceUsageTagEx tag_ex) const override;
     AccessContext *GetCurrentAccessContext() override { return current_access_context_; }
     const AccessContext *GetCurrentAccessContext() const override { return current_access_context_; }
@@ -345,9 +357,16 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
 
     void ResolveSubmitSemaphoreWait(const SignalInfo &signal_info, VkPipelineStageFlags2 wait_mask);
     void ImportTags(const QueueBatchContext &from);
+    // Must be called once all the batches this one depends on are resolved
+    void ApplyCollapsedSignalWaits();
 
   private:
+    // Submissions with fewer command buffers are cheaper to replay on the calling thread
+    static constexpr size_t kParallelReplayThreshold = 8;
+
     void ResolvePresentSemaphoreWait(const SignalInfo &signal_info, const PresentedImages &presented_images);
+    void DetectIndependentFirstUseHazards(const std::vector<CommandBufferConstPtr> &command_buffers,
+                                          std::vector<uint8_t> &detected, std::vector<HazardResult> &hazards) const;
 
   private:
     const QueueSyncState *queue_state_ = nullptr;
@@ -358,6 +377,9 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
     SyncEventsContext events_context_;
     BatchAccessLog batch_log_;
     std::vector<ResourceUsageTag> queue_sync_tag_;
+    bool collapsed_ = false;
+    // End of the latest collapsed batch waited on by a semaphore, zero if none
+    ResourceUsageTag collapsed_wait_tag_ = 0;
 };
 
 class QueueSyncState {
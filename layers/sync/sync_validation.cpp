@@ -38,7 +38,14 @@ static bool GetShowStatsEnvVar() {
 }
 
 SyncValidator::SyncValidator(vvl::dispatch::Device *dev, syncval::Instance *instance_vo)
-    : BaseClass(dev, instance_vo, LayerObjectTypeSyncValidation), error_messages_(*this), report_stats_(GetShowStatsEnvVar()) {}
+    : BaseClass(dev, instance_vo, LayerObjectTypeSyncValidation),
+      error_messages_(*this),
+      report_stats_(GetShowStatsEnvVar() || syncval_settings.stats) {
+    if (report_stats_) {
+        stats.Enable();
+        stats.report_period = syncval_settings.stats_report_period;
+    }
+}
 
 SyncValidator::~SyncValidator() {
     // Instance level SyncValidator does not have much to say
@@ -52,12 +59,16 @@ SyncValidator::~SyncValidator() {
 // Location to add per-queue submit debug info if built with -D DEBUG_CAPTURE_KEYBOARD=ON.
 void SyncValidator::DebugCapture() {
     if (report_stats_) {
-        const std::string report = stats.CreateReport();
-        std::cout << report;
+        PrintStats();
+    }
+}
+
+void SyncValidator::PrintStats() const {
+    const std::string report = stats.CreateReport();
+    std::cout << report;
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-        OutputDebugString(report.c_str());
+    OutputDebugString(report.c_str());
 #endif
-    }
 }
 
 bool SyncValidator::SyncError(SyncHazard hazard, const LogObjectList &objlist, const Location &loc,
@@ -97,7 +108,7 @@ void SyncValidator::EnsureTimelineSignalsLimit(uint32_t signals_per_queue_limit,
     }
 }
 
-void SyncValidator::ApplySignalsUpdate(SignalsUpdate &update, const QueueBatchContext::Ptr &last_batch) {
+void SyncValidator::ApplySignalsUpdate(SignalsUpdate &update, const QueueBatchContext::Ptr &last_batch, const Location &loc) {
     // NOTE: All conserved QueueBatchContexts need to have their access logs reset to use the global
     // logger and the only conserved QBCs are those referenced by unwaited signals and the last batch.
 
@@ -165,6 +176,72 @@ void SyncValidator::ApplySignalsUpdate(SignalsUpdate &update, const QueueBatchCo
     // This does not introduce errors/false-positives (check EnsureTimelineSignalsLimit documentation)
     const uint32_t kMaxTimelineSignalsPerQueue = 100;
     EnsureTimelineSignalsLimit(kMaxTimelineSignalsPerQueue);
+
+    if (syncval_settings.retained_memory_limit != 0) {
+        EnsureRetainedMemoryLimit(loc);
+    }
+}
+
+void SyncValidator::EnsureRetainedMemoryLimit(const Location &loc) {
+    // The last batches of the queues are needed for the next submissions, only the batches held by signals are candidates
+    // Many signals can point at the same batch, the set holds the last batches and the batches already added
+    vvl::unordered_set<const QueueBatchContext *> skipped_batches;
+    for (const auto &queue_sync_state : queue_sync_states_) {
+        if (auto last_batch = queue_sync_state->LastBatch()) {
+            skipped_batches.insert(last_batch.get());
+        }
+        if (auto pending_batch = queue_sync_state->PendingLastBatch()) {
+            skipped_batches.insert(pending_batch.get());
+        }
+    }
+
+    std::vector<QueueBatchContext::Ptr> retained_batches;
+    auto add_retained = [&](const QueueBatchContext::Ptr &batch) {
+        if (batch && !batch->IsCollapsed() && skipped_batches.insert(batch.get()).second) {
+            retained_batches.emplace_back(batch);
+        }
+    };
+    for (const auto &[_, signal] : binary_signals_) {
+        add_retained(signal.batch);
+    }
+    for (const auto &[_, signals] : timeline_signals_) {
+        for (const SignalInfo &signal : signals) {
+            add_retained(signal.batch);
+        }
+    }
+
+    size_t retained_memory = 0;
+    for (const auto &batch : retained_batches) {
+        retained_memory += batch->EstimateMemoryUsage();
+    }
+    const size_t memory_limit = size_t(syncval_settings.retained_memory_limit) * 1024 * 1024;
+    if (retained_memory <= memory_limit) {
+        return;
+    }
+
+    // Oldest batches first
+    std::sort(retained_batches.begin(), retained_batches.end(),
+              [](const auto &a, const auto &b) { return a->GetTagRange().begin < b->GetTagRange().begin; });
+    const size_t initial_retained_memory = retained_memory;
+    for (const auto &batch : retained_batches) {
+        if (retained_memory <= memory_limit) {
+            break;
+        }
+        // Estimate again after collapsing rather than assuming all of the batch memory is released
+        retained_memory -= batch->EstimateMemoryUsage();
+        batch->Collapse();
+        retained_memory += batch->EstimateMemoryUsage();
+    }
+
+    if (!retained_memory_limit_reported_) {
+        retained_memory_limit_reported_ = true;
+        LogInfo("SYNCVAL-RETAINED-MEMORY-LIMIT", device, loc,
+                "Memory of the submissions kept for semaphore waits is over syncval_retained_memory_limit (%" PRIu32
+                " MiB). Accesses of the oldest submissions are dropped and semaphore waits on them are treated as waits on "
+                "everything submitted before, so hazards against those accesses will not be reported. The estimated memory "
+                "went from %zu to %zu bytes. This message is reported only once.",
+                syncval_settings.retained_memory_limit, initial_retained_memory, retained_memory);
+    }
 }
 
 void SyncValidator::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag) {
@@ -2399,6 +2476,7 @@ bool SyncValidator::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresen
         batch->ResolveLastBatch(last_batch);
         resolved_batches.emplace_back(std::move(last_batch));
     }
+    batch->ApplyCollapsedSignalWaits();
 
     // The purpose of keeping return value is to ensure async batches are alive during validation.
     // Validation accesses raw pointer to async contexts stored in AsyncReference.
@@ -2462,7 +2540,7 @@ void SyncValidator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresent
     // Update the state with the data from the validate phase
     std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state->queue));
     if (!queue_state) return;  // Invalid Queue
-    ApplySignalsUpdate(cmd_state->signals_update, queue_state->PendingLastBatch());
+    ApplySignalsUpdate(cmd_state->signals_update, queue_state->PendingLastBatch(), record_obj.location);
     for (auto &presented : cmd_state->presented_images) {
         presented.ExportToSwapchain(*this);
     }
@@ -2615,6 +2693,7 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
             batch->ResolveLastBatch(last_batch);
             resolved_batches.emplace_back(std::move(last_batch));
         }
+        batch->ApplyCollapsedSignalWaits();
 
         // The purpose of keeping return value is to ensure async batches are alive during validation.
         // Validation accesses raw pointer to async contexts stored in AsyncReference.
@@ -2648,7 +2727,7 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
     }
 
     if (!skip) {
-        const_cast<SyncValidator *>(this)->RecordQueueSubmit(queue, fence, cmd_state);
+        const_cast<SyncValidator *>(this)->RecordQueueSubmit(queue, fence, cmd_state, error_obj.location);
     }
 
     // Note that if we skip, guard cleans up for us, but cannot release the reserved tag range
@@ -2746,6 +2825,7 @@ bool SyncValidator::ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, Si
         ready_batch.batch->ResolveLastBatch(last_batch);
         ready_batch.resolved_dependencies.emplace_back(std::move(last_batch));
     }
+    ready_batch.batch->ApplyCollapsedSignalWaits();
     last_batch = ready_batch.batch;
 
     const auto async_batches = ready_batch.batch->RegisterAsyncContexts(ready_batch.resolved_dependencies);
@@ -2757,8 +2837,12 @@ bool SyncValidator::ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, Si
     return signals_update.RegisterSignals(ready_batch.batch, submit_signals);
 }
 
-void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, QueueSubmitCmdState *cmd_state) {
+void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, QueueSubmitCmdState *cmd_state, const Location &loc) {
     stats.UpdateMemoryStats();
+    if (stats.AddSubmit()) {
+        PrintStats();
+    }
+    syncval_stats::ScopedTimer timer(stats, syncval_stats::Timer::kSubmitRecord);
 
     // If this return is above the TlsGuard, then the Validate phase return must also be.
     if (!syncval_settings.submit_time_validation) {
@@ -2771,7 +2855,7 @@ void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, QueueSubmitC
 
     // Don't need to look up the queue state again, but we need a non-const version
     std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state->queue));
-    ApplySignalsUpdate(cmd_state->signals_update, queue_state->PendingLastBatch());
+    ApplySignalsUpdate(cmd_state->signals_update, queue_state->PendingLastBatch(), loc);
 
     // Apply the pending state from the validation phase. Check all queues because timeline signals
     // on the current queue can resolve wait-before-signal batches on other queues.
@@ -2860,7 +2944,7 @@ void SyncValidator::PostCallRecordSignalSemaphore(VkDevice device, const VkSemap
     if (record_obj.result != VK_SUCCESS) {
         return;
     }
-    ApplySignalsUpdate(cmd_state->signals_update, nullptr);
+    ApplySignalsUpdate(cmd_state->signals_update, nullptr, record_obj.location);
     for (const auto &qs : queue_sync_states_) {
         qs->ApplyPendingLastBatch();
         qs->ApplyPendingUnresolvedBatches();
@@ -2927,7 +3011,7 @@ void SyncValidator::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapc
 // Otherwise returns a valid buffer (device address is associated with a single buffer).
 // When syncval adds memory aliasing support the need of this function can be revisited.
 static const vvl::Buffer *GetSingleBufferFromDeviceAddress(const vvl::DeviceState &device, VkDeviceAddress device_address) {
-    vvl::span<vvl::Buffer *const> buffers = device.GetBuffersByAddress(device_address);
+    const auto buffers = device.GetBuffersByAddress(device_address);
     if (buffers.empty()) {
         return nullptr;
     }
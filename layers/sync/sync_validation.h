@@ -54,7 +54,9 @@ class SyncValidator : public vvl::DeviceProxy {
     // - it is the first to be constructed: can observe all subsequent syncval stats events
     // - it is the last to be destroyed: ensures there are no unreported syncval stats events.
     mutable syncval_stats::Stats stats;  // Stats object is thread safe
+    // Stats are collected and reported if enabled by the syncval_stats setting or VK_SYNCVAL_SHOW_STATS environment variable
     const bool report_stats_ = false;
+    void PrintStats() const;
 
     // Global tag range for submitted command buffers resource usage logs
     // Started the global tag count at 1 s.t. zero are invalid and ResourceUsageTag normalization can just zero them.
@@ -93,7 +95,13 @@ class SyncValidator : public vvl::DeviceProxy {
 
     // Applies information from update object to binary_signals_/timeline_signals_.
     // The update object is mutable to be able to std::move SignalInfo from it.
-    void ApplySignalsUpdate(SignalsUpdate &update, const QueueBatchContext::Ptr &last_batch);
+    void ApplySignalsUpdate(SignalsUpdate &update, const QueueBatchContext::Ptr &last_batch, const Location &loc);
+
+    // Collapses the oldest batches that are kept alive only by registered signals until their estimated memory fits
+    // in the syncval_retained_memory_limit setting. Like dropping signals, this can miss hazards against old accesses
+    // but doesn't introduce false-positives (check QueueBatchContext::Collapse documentation).
+    void EnsureRetainedMemoryLimit(const Location &loc);
+    bool retained_memory_limit_reported_ = false;
 
     bool PropagateTimelineSignals(SignalsUpdate &signals_update, const ErrorObject &error_obj) const;
 
@@ -495,7 +503,7 @@ class SyncValidator : public vvl::DeviceProxy {
                              const ErrorObject &error_obj) const;
     bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                     const ErrorObject &error_obj) const override;
-    void RecordQueueSubmit(VkQueue queue, VkFence fence, QueueSubmitCmdState *cmd_state);
+    void RecordQueueSubmit(VkQueue queue, VkFence fence, QueueSubmitCmdState *cmd_state, const Location &loc);
     bool PreCallValidateQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits, VkFence fence,
                                         const ErrorObject &error_obj) const override;
     bool PreCallValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
@@ -0,0 +1,110 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_pool.h"
+
+#include <algorithm>
+
+namespace vvl {
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkerPool::Start() {
+    // hardware_concurrency() is allowed to return 0 if it can't tell, in which case everything runs on the caller
+    const uint32_t hw_threads = std::thread::hardware_concurrency();
+    const uint32_t worker_count = hw_threads > 1 ? std::min(hw_threads - 1, kMaxWorkers) : 0;
+    workers_.reserve(worker_count);
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        workers_.emplace_back(&WorkerPool::WorkerLoop, this);
+    }
+}
+
+uint32_t WorkerPool::WorkerCount() {
+    std::call_once(start_once_, [this]() { Start(); });
+    return static_cast<uint32_t>(workers_.size());
+}
+
+void WorkerPool::ParallelFor(uint32_t count, const std::function<void(uint32_t)> &func) {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1 || WorkerCount() == 0) {
+        for (uint32_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    auto job = std::make_shared<Job>(count, func);
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        jobs_.push_back(job);
+    }
+    work_cv_.notify_all();
+
+    RunJob(*job);
+
+    std::unique_lock<std::mutex> guard(lock_);
+    done_cv_.wait(guard, [&job]() { return job->done.load(std::memory_order_acquire) == job->count; });
+    // A worker may not have gotten to it yet, don't leave a finished job at the front of the queue
+    auto it = std::find(jobs_.begin(), jobs_.end(), job);
+    if (it != jobs_.end()) {
+        jobs_.erase(it);
+    }
+}
+
+void WorkerPool::RunJob(Job &job) {
+    for (uint32_t i = job.next.fetch_add(1, std::memory_order_relaxed); i < job.count;
+         i = job.next.fetch_add(1, std::memory_order_relaxed)) {
+        job.func(i);
+        if (job.done.fetch_add(1, std::memory_order_acq_rel) + 1 == job.count) {
+            // Take the lock so the waiting thread can't miss the notification between its check and its wait
+            std::lock_guard<std::mutex> guard(lock_);
+            done_cv_.notify_all();
+        }
+    }
+}
+
+void WorkerPool::WorkerLoop() {
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        work_cv_.wait(guard, [this]() { return stop_ || !jobs_.empty(); });
+        if (stop_) {
+            return;
+        }
+        std::shared_ptr<Job> job = jobs_.front();
+        if (job->next.load(std::memory_order_relaxed) >= job->count) {
+            // Every index has been handed out, the threads still running it will finish it
+            jobs_.pop_front();
+            continue;
+        }
+        guard.unlock();
+        RunJob(*job);
+        guard.lock();
+    }
+}
+
+}  // namespace vvl
@@ -0,0 +1,75 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Small pool of worker threads used to split up validation of calls that take large arrays of independent work
+// (ex. vkCreateGraphicsPipelines with hundreds of pCreateInfos).
+// The threads are only started the first time there is work for them.
+class WorkerPool {
+  public:
+    WorkerPool() = default;
+    ~WorkerPool();
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // Calls func(i) for every i in [0, count) and returns once all of them are done.
+    // The calling thread takes part in the work, so this is safe to call from a worker thread as well.
+    // There is no ordering between the calls, func must only touch state owned by index i.
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)> &func);
+
+    // Number of threads (not counting the caller) that ParallelFor can spread work to
+    uint32_t WorkerCount();
+
+  private:
+    struct Job {
+        Job(uint32_t count, const std::function<void(uint32_t)> &func) : count(count), func(func) {}
+        const uint32_t count;
+        const std::function<void(uint32_t)> &func;
+        std::atomic<uint32_t> next{0};
+        std::atomic<uint32_t> done{0};
+    };
+
+    void Start();
+    void WorkerLoop();
+    void RunJob(Job &job);
+
+    // Keep the pool small, it is shared by the whole device and the work items are coarse
+    static constexpr uint32_t kMaxWorkers = 16;
+
+    std::once_flag start_once_;
+    std::mutex lock_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    std::deque<std::shared_ptr<Job>> jobs_;
+    std::vector<std::thread> workers_;
+    bool stop_{false};
+};
+
+}  // namespace vvl
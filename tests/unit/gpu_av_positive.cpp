@@ -16,6 +16,9 @@
  */
 
 #include <vulkan/vulkan_core.h>
+#include <chrono>
+#include <filesystem>
+#include <random>
 #include <vector>
 #include "../framework/layer_validation_tests.h"
 #include "../framework/buffer_helper.h"
@@ -2239,3 +2242,73 @@ TEST_F(PositiveGpuAV, MixDynamicNormalRenderPass) {
     m_command_buffer.End();
     m_default_queue->SubmitAndWait(m_command_buffer);
 }
+
+TEST_F(PositiveGpuAV, InstrumentedShaderCache) {
+    TEST_DESCRIPTION("A shader instrumented by a previous device is loaded from the cache instead of being instrumented again");
+    // Own directory so earlier runs (or the user's real cache) can't change the result
+    std::random_device random;
+    const std::filesystem::path cache_dir =
+        std::filesystem::temp_directory_path() / ("vvl_gpuav_shader_cache_test_" + std::to_string(random()));
+    const std::string cache_dir_string = cache_dir.string();
+    const char *cache_dir_setting = cache_dir_string.c_str();
+    std::vector<VkLayerSettingEXT> layer_settings = {
+        {OBJECT_LAYER_NAME, "gpuav_cache_instrumented_shaders", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kVkTrue},
+        {OBJECT_LAYER_NAME, "gpuav_instrumented_shader_cache_dir", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &cache_dir_setting}};
+    RETURN_IF_SKIP(InitGpuAvFramework(layer_settings));
+    RETURN_IF_SKIP(InitState());
+    std::filesystem::create_directories(cache_dir);
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; };
+        void main() {
+            data[gl_GlobalInvocationID.x] = 42;
+        }
+    )glsl";
+    const std::vector<uint32_t> cs_spirv = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, cs_source);
+
+    // The cache is loaded when the device is created and saved when it is destroyed
+    auto create_pipeline = [&](vkt::Device &device) {
+        VkShaderModuleCreateInfo module_ci = vku::InitStructHelper();
+        module_ci.codeSize = cs_spirv.size() * sizeof(uint32_t);
+        module_ci.pCode = cs_spirv.data();
+        vkt::ShaderModule shader_module(device, module_ci);
+        const VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT,
+                                                      nullptr};
+        vkt::DescriptorSetLayout set_layout(device, binding);
+        vkt::PipelineLayout pipeline_layout(device, {&set_layout});
+
+        VkComputePipelineCreateInfo pipeline_ci = vku::InitStructHelper();
+        pipeline_ci.stage = vku::InitStructHelper();
+        pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipeline_ci.stage.module = shader_module;
+        pipeline_ci.stage.pName = "main";
+        pipeline_ci.layout = pipeline_layout;
+        vkt::Pipeline pipeline(device, pipeline_ci);
+    };
+
+    {
+        vkt::Device device(Gpu(), m_device_extension_names);
+        create_pipeline(device);
+    }
+
+    // The first device instrumented the shader and saved it
+    std::vector<std::filesystem::path> cache_files;
+    for (const auto &dir_entry : std::filesystem::directory_iterator(cache_dir)) {
+        cache_files.emplace_back(dir_entry.path());
+    }
+    ASSERT_EQ(1u, cache_files.size());
+    ASSERT_GT(std::filesystem::file_size(cache_files[0]), 0u);
+    // Backdated so a rewrite shows up whatever the file system timestamp resolution is
+    const auto backdated_time = std::filesystem::last_write_time(cache_files[0]) - std::chrono::hours(1);
+    std::filesystem::last_write_time(cache_files[0], backdated_time);
+
+    // The cache is only written back when a shader had to be instrumented, a hit for every shader leaves the file untouched
+    {
+        vkt::Device device(Gpu(), m_device_extension_names);
+        create_pipeline(device);
+    }
+    ASSERT_TRUE(backdated_time == std::filesystem::last_write_time(cache_files[0]));
+
+    std::filesystem::remove_all(cache_dir);
+}
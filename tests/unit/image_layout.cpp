@@ -709,6 +709,71 @@ TEST_F(NegativeImageLayout, ArrayLayers) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeImageLayout, ResubmitAfterGlobalLayoutChange) {
+    TEST_DESCRIPTION("Resubmit a command buffer that was valid before, after another submission changed the image layout");
+    RETURN_IF_SKIP(Init());
+
+    auto image_ci = vkt::Image::ImageCreateInfo2D(32, 32, 1, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    vkt::Image image(*m_device, image_ci);
+
+    VkImageMemoryBarrier img_barrier = vku::InitStructHelper();
+    img_barrier.image = image;
+    img_barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    auto record_transition = [&img_barrier](vkt::CommandBuffer &cb, VkImageLayout old_layout, VkImageLayout new_layout) {
+        img_barrier.oldLayout = old_layout;
+        img_barrier.newLayout = new_layout;
+        cb.Begin();
+        vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0,
+                               nullptr, 1, &img_barrier);
+        cb.End();
+    };
+
+    vkt::CommandBuffer to_general(*m_device, m_command_pool);
+    record_transition(to_general, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL);
+    vkt::CommandBuffer general_to_general(*m_device, m_command_pool);
+    record_transition(general_to_general, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL);
+    vkt::CommandBuffer to_transfer_dst(*m_device, m_command_pool);
+    record_transition(to_transfer_dst, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    m_default_queue->SubmitAndWait(to_general);
+    m_default_queue->SubmitAndWait(general_to_general);
+    m_default_queue->SubmitAndWait(general_to_general);
+
+    m_default_queue->SubmitAndWait(to_transfer_dst);
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-09600");
+    m_default_queue->SubmitAndWait(general_to_general);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeImageLayout, SubresourceCountAtSmallMapLimit) {
+    TEST_DESCRIPTION("Layout mismatch on the last subresource of an image that still uses the dense layout map");
+    RETURN_IF_SKIP(Init());
+
+    // 8 mips * 8 layers == 64 subresources
+    auto image_ci = vkt::Image::ImageCreateInfo2D(128, 128, 8, 8, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    vkt::Image image(*m_device, image_ci);
+
+    m_command_buffer.Begin();
+    VkImageMemoryBarrier img_barrier = vku::InitStructHelper();
+    img_barrier.srcAccessMask = 0;
+    img_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    img_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    img_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    img_barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 8, 0, 8};
+    img_barrier.image = image;
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr,
+                           0, nullptr, 1, &img_barrier);
+
+    img_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    img_barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    img_barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 7, 1, 7, 1};
+    m_errorMonitor->SetDesiredError("VUID-VkImageMemoryBarrier-oldLayout-01197");
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr,
+                           0, nullptr, 1, &img_barrier);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeImageLayout, MultiArrayLayers) {
     TEST_DESCRIPTION("https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/1998");
     RETURN_IF_SKIP(Init());
@@ -1055,6 +1055,70 @@ TEST_F(NegativePipeline, MissingEntrypointInline) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativePipeline, InlineSpirvSharedAcrossPipelines) {
+    TEST_DESCRIPTION("Pipelines sharing the parsed module of identical inline SPIR-V are still validated against their own state");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_KHR_MAINTENANCE_5_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::maintenance5);
+    RETURN_IF_SKIP(Init());
+
+    char const *cs_source = R"glsl(
+        #version 450
+        layout(local_size_x=1) in;
+        layout(set=0, binding=0) buffer block { vec4 x; };
+        void main(){
+           x = vec4(1);
+        }
+    )glsl";
+    std::vector<uint32_t> shader;
+    GLSLtoSPV(m_device->Physical().limits_, VK_SHADER_STAGE_COMPUTE_BIT, cs_source, shader);
+
+    VkShaderModuleCreateInfo module_create_info = vku::InitStructHelper();
+    module_create_info.pCode = shader.data();
+    module_create_info.codeSize = shader.size() * sizeof(uint32_t);
+
+    VkPipelineShaderStageCreateInfo stage_ci = vku::InitStructHelper(&module_create_info);
+    stage_ci.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    stage_ci.module = VK_NULL_HANDLE;
+    stage_ci.pName = "main";
+
+    const VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+    vkt::DescriptorSetLayout set_layout(*m_device, binding);
+    vkt::PipelineLayout layout(*m_device, {&set_layout});
+    vkt::PipelineLayout empty_layout(*m_device, {});
+
+    // Kept alive so every following pipeline finds the module in the cache
+    CreateComputePipelineHelper first_pipe(*this);
+    first_pipe.cp_ci_.stage = stage_ci;
+    first_pipe.cp_ci_.layout = layout;
+    first_pipe.CreateComputePipeline(false);
+
+    {
+        CreateComputePipelineHelper pipe(*this);
+        pipe.cp_ci_.stage = stage_ci;
+        pipe.cp_ci_.layout = empty_layout;
+        m_errorMonitor->SetDesiredError("VUID-VkComputePipelineCreateInfo-layout-07988");
+        pipe.CreateComputePipeline(false);
+        m_errorMonitor->VerifyFound();
+    }
+    {
+        CreateComputePipelineHelper pipe(*this);
+        pipe.cp_ci_.stage = stage_ci;
+        pipe.cp_ci_.stage.pName = "foo";
+        pipe.cp_ci_.layout = layout;
+        m_errorMonitor->SetDesiredError("VUID-VkPipelineShaderStageCreateInfo-pName-00707");
+        pipe.CreateComputePipeline(false);
+        m_errorMonitor->VerifyFound();
+    }
+    {
+        // Neither error stuck to the shared module
+        CreateComputePipelineHelper pipe(*this);
+        pipe.cp_ci_.stage = stage_ci;
+        pipe.cp_ci_.layout = layout;
+        pipe.CreateComputePipeline(false);
+    }
+}
+
 TEST_F(NegativePipeline, DepthStencilRequired) {
     m_errorMonitor->SetDesiredError("VUID-VkGraphicsPipelineCreateInfo-renderPass-09028");
 
@@ -2426,6 +2490,165 @@ TEST_F(NegativePipeline, CreateComputePipelineWithDerivatives) {
     }
 }
 
+TEST_F(NegativePipeline, CreateComputePipelinesLargeBatchDerivatives) {
+    TEST_DESCRIPTION("Errors in a large vkCreateComputePipelines batch, which is validated on multiple threads");
+
+    RETURN_IF_SKIP(Init());
+
+    VkShaderObj cs(this, kMinimalShaderGlsl, VK_SHADER_STAGE_COMPUTE_BIT);
+    const vkt::PipelineLayout pipeline_layout(*m_device, {});
+
+    constexpr uint32_t pipeline_count = 64;
+    std::vector<VkComputePipelineCreateInfo> compute_create_infos(pipeline_count);
+    for (auto &create_info : compute_create_infos) {
+        create_info = vku::InitStructHelper();
+        create_info.stage = cs.GetStageCreateInfo();
+        create_info.layout = pipeline_layout;
+        create_info.basePipelineIndex = -1;
+    }
+    // Base pipeline lacks the VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT flag
+    for (uint32_t i : {7u, 31u, 63u}) {
+        compute_create_infos[i].flags = VK_PIPELINE_CREATE_DERIVATIVE_BIT;
+        compute_create_infos[i].basePipelineIndex = 0;
+        m_errorMonitor->SetDesiredError("VUID-vkCreateComputePipelines-flags-00696");
+    }
+
+    std::vector<VkPipeline> pipelines(pipeline_count, VK_NULL_HANDLE);
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, pipeline_count, compute_create_infos.data(), nullptr, pipelines.data());
+    m_errorMonitor->VerifyFound();
+    for (auto pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
+
+TEST_F(NegativePipeline, CreateGraphicsPipelinesLargeBatchSameAsSerial) {
+    TEST_DESCRIPTION("A large batch, validated on multiple threads, reports the same errors as a single pipeline");
+
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    // Every location mismatches, but the interface check stops at the first one once it has an error
+    char const *vs_source = R"glsl(
+        #version 450
+        layout(location=0) out int x;
+        layout(location=1) out int y;
+        void main(){
+           x = 0;
+           y = 0;
+           gl_Position = vec4(1);
+        }
+    )glsl";
+    char const *fs_source = R"glsl(
+        #version 450
+        layout(location=0) in float x;
+        layout(location=1) in float y;
+        layout(location=0) out vec4 color;
+        void main(){
+           color = vec4(x + y);
+        }
+    )glsl";
+    VkShaderObj vs(this, vs_source, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, fs_source, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.LateBindPipelineInfo();
+
+    m_errorMonitor->SetDesiredError("VUID-RuntimeSpirv-OpEntryPoint-07754");
+    pipe.CreateGraphicsPipeline(false);
+    m_errorMonitor->VerifyFound();
+
+    constexpr uint32_t pipeline_count = 8;
+    std::vector<VkGraphicsPipelineCreateInfo> create_infos(pipeline_count, pipe.gp_ci_);
+    std::vector<VkPipeline> pipelines(pipeline_count, VK_NULL_HANDLE);
+    m_errorMonitor->SetDesiredError("VUID-RuntimeSpirv-OpEntryPoint-07754", pipeline_count);
+    vk::CreateGraphicsPipelines(device(), VK_NULL_HANDLE, pipeline_count, create_infos.data(), nullptr, pipelines.data());
+    m_errorMonitor->VerifyFound();
+    for (auto pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
+
+TEST_F(NegativePipeline, CreateGraphicsPipelinesLargeBatchFalseCallback) {
+    TEST_DESCRIPTION("With callbacks returning VK_FALSE, a batch validated on multiple threads reports the same errors as serial");
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    // Every location mismatches, without a callback asking to skip the interface check reports all of them
+    char const *vs_source = R"glsl(
+        #version 450
+        layout(location=0) out int x;
+        layout(location=1) out int y;
+        void main(){
+           x = 0;
+           y = 0;
+           gl_Position = vec4(1);
+        }
+    )glsl";
+    char const *fs_source = R"glsl(
+        #version 450
+        layout(location=0) in float x;
+        layout(location=1) in float y;
+        layout(location=0) out vec4 color;
+        void main(){
+           color = vec4(x + y);
+        }
+    )glsl";
+    VkShaderObj vs(this, vs_source, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, fs_source, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.LateBindPipelineInfo();
+
+    // The error monitor returns VK_FALSE for allowed messages, and so does this callback
+    std::vector<std::string> messages;
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.callback = [&messages](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData, DebugUtilsLabelCheckData *) {
+        if (pCallbackData->pMessageIdName &&
+            std::string_view(pCallbackData->pMessageIdName) == "VUID-RuntimeSpirv-OpEntryPoint-07754") {
+            messages.emplace_back(pCallbackData->pMessage);
+        }
+    };
+    callback_data.count = 0;
+    VkDebugUtilsMessengerCreateInfoEXT messenger_ci = vku::InitStructHelper();
+    messenger_ci.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    messenger_ci.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    messenger_ci.pfnUserCallback = DebugUtilsCallback;
+    messenger_ci.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    vk::CreateDebugUtilsMessengerEXT(instance(), &messenger_ci, nullptr, &messenger);
+    m_errorMonitor->SetAllowedFailureMsg("VUID-RuntimeSpirv-OpEntryPoint-07754");
+
+    auto create_pipelines = [&](uint32_t pipeline_count) {
+        std::vector<VkGraphicsPipelineCreateInfo> create_infos(pipeline_count, pipe.gp_ci_);
+        std::vector<VkPipeline> pipelines(pipeline_count, VK_NULL_HANDLE);
+        vk::CreateGraphicsPipelines(device(), VK_NULL_HANDLE, pipeline_count, create_infos.data(), nullptr, pipelines.data());
+        for (auto pipeline : pipelines) {
+            vk::DestroyPipeline(device(), pipeline, nullptr);
+        }
+    };
+
+    // One short of the parallel threshold (8), validated serially
+    constexpr uint32_t serial_count = 7;
+    create_pipelines(serial_count);
+    const std::vector<std::string> serial_messages = std::move(messages);
+    messages.clear();
+    ASSERT_FALSE(serial_messages.empty());
+    ASSERT_EQ(0u, serial_messages.size() % serial_count);
+    const size_t messages_per_pipeline = serial_messages.size() / serial_count;
+
+    // Each message is reported once, in pCreateInfos order, and the pipelines validated serially report the same ones
+    create_pipelines(serial_count + 1);
+    ASSERT_EQ(messages_per_pipeline * (serial_count + 1), messages.size());
+    for (size_t i = 0; i < serial_messages.size(); ++i) {
+        EXPECT_EQ(serial_messages[i], messages[i]);
+    }
+
+    vk::DestroyDebugUtilsMessengerEXT(instance(), messenger, nullptr);
+}
+
 TEST_F(NegativePipeline, GraphicsPipelineWithBadBasePointer) {
     TEST_DESCRIPTION("Create Graphics Pipeline with bad base pointer");
 
@@ -2053,3 +2053,64 @@ TEST_F(PositivePipeline, SampleLocations) {
     vk::CmdEndRenderPass(m_command_buffer);
     m_command_buffer.End();
 }
+
+TEST_F(PositivePipeline, InlineSpirvSharedAcrossPipelines) {
+    TEST_DESCRIPTION("Create many pipelines from the same inline SPIR-V, which share a single parsed module");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_KHR_MAINTENANCE_5_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::maintenance5);
+    RETURN_IF_SKIP(Init());
+
+    std::vector<uint32_t> shader;
+    GLSLtoSPV(m_device->Physical().limits_, VK_SHADER_STAGE_COMPUTE_BIT, kMinimalShaderGlsl, shader);
+
+    VkShaderModuleCreateInfo module_create_info = vku::InitStructHelper();
+    module_create_info.pCode = shader.data();
+    module_create_info.codeSize = shader.size() * sizeof(uint32_t);
+
+    VkPipelineShaderStageCreateInfo stage_ci = vku::InitStructHelper(&module_create_info);
+    stage_ci.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    stage_ci.module = VK_NULL_HANDLE;
+    stage_ci.pName = "main";
+
+    vkt::PipelineLayout layout(*m_device, {});
+
+    {
+        CreateComputePipelineHelper pipe(*this);
+        pipe.cp_ci_.stage = stage_ci;
+        pipe.cp_ci_.layout = layout;
+        pipe.CreateComputePipeline(false);
+    }
+
+    // The first pipeline (and its module) is gone, make sure the next ones don't see a stale entry
+    std::vector<std::unique_ptr<CreateComputePipelineHelper>> pipes;
+    for (uint32_t i = 0; i < 4; ++i) {
+        auto &pipe = pipes.emplace_back(std::make_unique<CreateComputePipelineHelper>(*this));
+        pipe->cp_ci_.stage = stage_ci;
+        pipe->cp_ci_.layout = layout;
+        pipe->CreateComputePipeline(false);
+    }
+}
+
+TEST_F(PositivePipeline, CreateComputePipelinesLargeBatch) {
+    TEST_DESCRIPTION("Create a large batch of compute pipelines in a single call, which is validated on multiple threads");
+    RETURN_IF_SKIP(Init());
+
+    VkShaderObj cs(this, kMinimalShaderGlsl, VK_SHADER_STAGE_COMPUTE_BIT);
+    vkt::PipelineLayout layout(*m_device, {});
+
+    constexpr uint32_t pipeline_count = 64;
+    std::vector<VkComputePipelineCreateInfo> create_infos(pipeline_count);
+    for (auto &create_info : create_infos) {
+        create_info = vku::InitStructHelper();
+        create_info.stage = cs.GetStageCreateInfo();
+        create_info.layout = layout;
+        create_info.basePipelineIndex = -1;
+    }
+
+    std::vector<VkPipeline> pipelines(pipeline_count, VK_NULL_HANDLE);
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, pipeline_count, create_infos.data(), nullptr, pipelines.data());
+    for (auto pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
@@ -413,6 +413,73 @@ TEST_F(PositiveSparseBuffer, NonOverlappingBufferCopy5) {
     m_default_queue->Wait();
 }
 
+TEST_F(PositiveSparseBuffer, NonOverlappingBufferCopyUnsortedBinds) {
+    TEST_DESCRIPTION("Bind buffer pages in reverse order, including a rebind within the same batch, then copy between them");
+    AddRequiredFeature(vkt::Feature::sparseBinding);
+    RETURN_IF_SKIP(Init());
+
+    if (m_device->QueuesWithSparseCapability().empty()) {
+        GTEST_SKIP() << "Required SPARSE_BINDING queue families not present";
+    }
+
+    VkBufferCreateInfo b_info =
+        vkt::Buffer::CreateInfo(0x40000, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    b_info.flags = VK_BUFFER_CREATE_SPARSE_BINDING_BIT;
+    vkt::Buffer buffer_sparse(*m_device, b_info, vkt::no_mem);
+    vkt::Buffer buffer_sparse2(*m_device, b_info, vkt::no_mem);
+
+    VkMemoryRequirements buffer_mem_reqs;
+    vk::GetBufferMemoryRequirements(device(), buffer_sparse, &buffer_mem_reqs);
+    const VkDeviceSize page_size = buffer_mem_reqs.alignment;
+    const uint32_t page_count = static_cast<uint32_t>(buffer_mem_reqs.size / page_size);
+    if (page_count < 2) {
+        GTEST_SKIP() << "Need at least 2 sparse pages";
+    }
+
+    // One allocation backing both buffers, first half for buffer_sparse and second half for buffer_sparse2
+    VkMemoryRequirements mem_reqs = buffer_mem_reqs;
+    mem_reqs.size = 2 * buffer_mem_reqs.size;
+    VkMemoryAllocateInfo buffer_mem_alloc =
+        vkt::DeviceMemory::GetResourceAllocInfo(*m_device, mem_reqs, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    vkt::DeviceMemory buffer_mem(*m_device, buffer_mem_alloc);
+
+    std::vector<VkSparseMemoryBind> binds;
+    std::vector<VkSparseMemoryBind> binds2;
+    // buffer_sparse2 page 0 first aliases buffer_sparse page 0, then is rebound later in the same batch
+    binds2.push_back({0, page_size, buffer_mem, 0, 0});
+    for (uint32_t page = page_count; page-- > 0;) {
+        binds.push_back({page * page_size, page_size, buffer_mem, page * page_size, 0});
+        binds2.push_back({page * page_size, page_size, buffer_mem, buffer_mem_reqs.size + page * page_size, 0});
+    }
+
+    VkSparseBufferMemoryBindInfo buffer_memory_bind_infos[2] = {};
+    buffer_memory_bind_infos[0].buffer = buffer_sparse;
+    buffer_memory_bind_infos[0].bindCount = static_cast<uint32_t>(binds.size());
+    buffer_memory_bind_infos[0].pBinds = binds.data();
+    buffer_memory_bind_infos[1].buffer = buffer_sparse2;
+    buffer_memory_bind_infos[1].bindCount = static_cast<uint32_t>(binds2.size());
+    buffer_memory_bind_infos[1].pBinds = binds2.data();
+
+    VkBindSparseInfo bind_info = vku::InitStructHelper();
+    bind_info.bufferBindCount = 2;
+    bind_info.pBufferBinds = buffer_memory_bind_infos;
+
+    vkt::Queue* sparse_queue = m_device->QueuesWithSparseCapability()[0];
+    vk::QueueBindSparse(sparse_queue->handle(), 1, &bind_info, VK_NULL_HANDLE);
+    sparse_queue->Wait();
+
+    VkBufferCopy copy_info;
+    copy_info.srcOffset = 0;
+    copy_info.dstOffset = 0;
+    copy_info.size = b_info.size;
+
+    m_command_buffer.Begin();
+    vk::CmdCopyBuffer(m_command_buffer, buffer_sparse, buffer_sparse2, 1, &copy_info);
+    m_command_buffer.End();
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+}
+
 TEST_F(PositiveSparseBuffer, BindSparseEmpty) {
     TEST_DESCRIPTION("Test submitting empty queue bind sparse");
     AddRequiredFeature(vkt::Feature::sparseBinding);
@@ -2328,6 +2328,26 @@ TEST_F(PositiveSyncObject, TimelineSubmitWaitThenHostSignalLargerValue) {
     m_default_queue->Wait();
 }
 
+TEST_F(PositiveSyncObject, TimelineOutOfOrderPayloads) {
+    TEST_DESCRIPTION("Register timeline waits and signals with payloads that are not increasing");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::timelineSemaphore);
+    all_queue_count_ = true;
+    RETURN_IF_SKIP(Init());
+
+    if (!m_second_queue) {
+        GTEST_SKIP() << "2 queues are needed";
+    }
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+    m_default_queue->Submit(vkt::no_cmd, vkt::TimelineWait(semaphore, 4));
+    m_default_queue->Submit(vkt::no_cmd, vkt::TimelineWait(semaphore, 2));
+    for (uint64_t value = 1; value <= 5; ++value) {
+        m_second_queue->Submit(vkt::no_cmd, vkt::TimelineSignal(semaphore, value));
+    }
+    m_default_queue->Wait();
+    semaphore.Wait(5, kWaitTimeout);
+}
+
 TEST_F(PositiveSyncObject, PollSemaphoreCounter) {
     TEST_DESCRIPTION("Basic semaphore polling test");
     SetTargetApiVersion(VK_API_VERSION_1_2);
@@ -1591,6 +1591,54 @@ TEST_F(NegativeSyncVal, UniformBufferDescriptorHazard) {
     m_command_buffer.End();
 }
 
+TEST_F(NegativeSyncVal, UniformBufferDynamicOffsetHazard) {
+    TEST_DESCRIPTION("Dispatches that share the bound descriptor set but use different dynamic offsets access different ranges");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    vkt::Buffer buffer(*m_device, 512, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer source_buffer(*m_device, 512, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {
+                                           {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                                       });
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer, 0, 256, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char* cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) uniform UB { float x; } uniform_buffer;
+        void main(){
+            float data = uniform_buffer.x;
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = VkShaderObj(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+    pipe.CreateComputePipeline();
+
+    m_command_buffer.Begin();
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe);
+    uint32_t dynamic_offset = 0;
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_, 0, 1, &descriptor_set.set_,
+                              1, &dynamic_offset);
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+
+    // Write the second half, the first dispatch only reads the first one
+    VkBufferCopy region = {256, 256, 256};
+    vk::CmdCopyBuffer(m_command_buffer, source_buffer, buffer, 1, &region);
+
+    // Same pipeline and descriptor set, only the dynamic offset changes
+    dynamic_offset = 256;
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_, 0, 1, &descriptor_set.set_,
+                              1, &dynamic_offset);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-READ-AFTER-WRITE");
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeSyncVal, SampledImageDescriptorHazard) {
     TEST_DESCRIPTION("Hazard when compute shader reads sampled image");
     RETURN_IF_SKIP(InitSyncVal());
@@ -4274,6 +4322,42 @@ TEST_F(NegativeSyncVal, QSBufferCopyHazards) {
     test.DeviceWait();
 }
 
+TEST_F(NegativeSyncVal, QSResubmitWithBarriers) {
+    TEST_DESCRIPTION("Resubmit a command buffer that has accesses on both sides of a barrier");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    QSTestContext test(m_device, m_device->QueuesWithGraphicsCapability()[0]);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires a valid queue object.";
+    }
+
+    test.BeginA();
+    test.Copy(test.buffer_a, test.buffer_b);
+    test.TransferBarrierRAW(test.buffer_b);
+    test.Copy(test.buffer_b, test.buffer_c);
+    test.End();
+
+    test.Submit0(test.cba);
+
+    // Write to buffer_b before the barrier races the read of the previous submission,
+    // the write to buffer_c after the barrier races the previous write
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-READ");
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    test.Submit0(test.cba);
+    m_errorMonitor->VerifyFound();
+
+    test.DeviceWait();
+    test.Submit0(test.cba);
+
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-READ");
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    test.Submit0(test.cba);
+    m_errorMonitor->VerifyFound();
+
+    test.DeviceWait();
+}
+
 TEST_F(NegativeSyncVal, QSSubmit2) {
     SetTargetApiVersion(VK_API_VERSION_1_3);
     AddRequiredFeature(vkt::Feature::synchronization2);
@@ -5461,6 +5545,133 @@ TEST_F(NegativeSyncVal, WriteSameLocationFromTwoSubmits) {
     m_default_queue->Wait();
 }
 
+TEST_F(NegativeSyncVal, ParallelSubmitReplaySameAsSerial) {
+    TEST_DESCRIPTION("A hazard found by the parallel submit replay of independent command buffers is reported like the serial one");
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(InitSyncVal());
+
+    // Capture the full text of the hazards, the error monitor only matches substrings
+    std::vector<std::string> hazard_messages;
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.callback = [&hazard_messages](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData,
+                                                DebugUtilsLabelCheckData *) {
+        if (pCallbackData->pMessageIdName &&
+            std::string_view(pCallbackData->pMessageIdName) == "SYNC-HAZARD-READ-AFTER-WRITE") {
+            hazard_messages.emplace_back(pCallbackData->pMessage);
+        }
+    };
+    callback_data.count = 0;
+    VkDebugUtilsMessengerCreateInfoEXT messenger_ci = vku::InitStructHelper();
+    messenger_ci.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    messenger_ci.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    messenger_ci.pfnUserCallback = DebugUtilsCallback;
+    messenger_ci.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    vk::CreateDebugUtilsMessengerEXT(instance(), &messenger_ci, nullptr, &messenger);
+
+    constexpr VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    // Enough command buffers to reach the parallel replay threshold (8)
+    constexpr uint32_t cb_count = 8;
+    constexpr uint32_t hazard_index = 5;
+    std::vector<vkt::Buffer> src_buffers;
+    std::vector<vkt::Buffer> dst_buffers;
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        src_buffers.emplace_back(*m_device, 256, usage);
+        dst_buffers.emplace_back(*m_device, 256, usage);
+    }
+    vkt::Buffer prior_src(*m_device, 256, usage);
+    vkt::Buffer written(*m_device, 256, usage);
+
+    vkt::CommandBuffer prior_cb(*m_device, m_command_pool);
+    prior_cb.Begin();
+    prior_cb.Copy(prior_src, written);
+    prior_cb.End();
+
+    // Every command buffer touches its own buffers, except the one that reads what prior_cb writes
+    std::vector<vkt::CommandBuffer> cbs;
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        cbs.emplace_back(*m_device, m_command_pool);
+        cbs[i].Begin();
+        cbs[i].Copy(i == hazard_index ? written : src_buffers[i], dst_buffers[i]);
+        cbs[i].End();
+    }
+    // Reads the same buffer as cbs[0], which makes the batch one independent command buffer short of the threshold
+    vkt::CommandBuffer overlapping_cb(*m_device, m_command_pool);
+    overlapping_cb.Begin();
+    overlapping_cb.Copy(src_buffers[0], dst_buffers[1]);
+    overlapping_cb.End();
+
+    std::vector<VkCommandBuffer> parallel_batch;
+    for (const auto &cb : cbs) {
+        parallel_batch.emplace_back(cb);
+    }
+    std::vector<VkCommandBuffer> serial_batch = parallel_batch;
+    serial_batch[1] = overlapping_cb;
+
+    m_default_queue->Submit(prior_cb);
+
+    // Both submits are skipped, so each one is validated against the same prior_cb submission
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-READ-AFTER-WRITE");
+    m_default_queue->Submit(parallel_batch);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-READ-AFTER-WRITE");
+    m_default_queue->Submit(serial_batch);
+    m_errorMonitor->VerifyFound();
+
+    m_default_queue->Wait();
+    vk::DestroyDebugUtilsMessengerEXT(instance(), messenger, nullptr);
+
+    ASSERT_EQ(2u, hazard_messages.size());
+    ASSERT_EQ(hazard_messages[0], hazard_messages[1]);
+}
+
+TEST_F(NegativeSyncVal, ShardedBatchTrim) {
+    TEST_DESCRIPTION("Submit enough distinct accesses for the batch trim to be split over the worker pool");
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(InitSyncVal());
+
+    // The trim is sharded above 2 * 4096 access map entries. Each labeled copy writes 4096 disjoint ranges in its own part
+    // of the buffer, so every shard holds the accesses of a different command.
+    constexpr uint32_t copy_count = 4;
+    constexpr uint32_t regions_per_copy = 4096;
+    constexpr uint32_t region_count = copy_count * regions_per_copy;
+    constexpr VkDeviceSize buffer_size = region_count * 8;
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer src(*m_device, buffer_size, usage);
+    vkt::Buffer dst(*m_device, buffer_size, usage);
+    vkt::Buffer readback(*m_device, 4, usage);
+
+    std::vector<VkBufferCopy> regions(region_count);
+    for (uint32_t i = 0; i < region_count; ++i) {
+        regions[i] = {i * 8u, i * 8u, 4};
+    }
+    const std::array<const char *, copy_count> label_names = {"Copy0", "Copy1", "Copy2", "Copy3"};
+    VkDebugUtilsLabelEXT label = vku::InitStructHelper();
+
+    vkt::CommandBuffer cb_write(*m_device, m_command_pool);
+    cb_write.Begin();
+    for (uint32_t i = 0; i < copy_count; ++i) {
+        label.pLabelName = label_names[i];
+        vk::CmdBeginDebugUtilsLabelEXT(cb_write, &label);
+        vk::CmdCopyBuffer(cb_write, src, dst, regions_per_copy, &regions[i * regions_per_copy]);
+        vk::CmdEndDebugUtilsLabelEXT(cb_write);
+    }
+    cb_write.End();
+    m_default_queue->Submit(cb_write);
+
+    // Reads the last range written by Copy3, the hazard needs the access log entry kept by the last shard
+    const VkBufferCopy read_region = {regions.back().dstOffset, 0, 4};
+    vkt::CommandBuffer cb_read(*m_device, m_command_pool);
+    cb_read.Begin();
+    vk::CmdCopyBuffer(cb_read, dst, readback, 1, &read_region);
+    cb_read.End();
+    m_errorMonitor->SetDesiredErrorRegex("SYNC-HAZARD-READ-AFTER-WRITE", "(?=.*Copy3)(?!.*Copy[012])");
+    m_default_queue->Submit(cb_read);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeSyncVal, ResourceHandleIndexStability) {
     TEST_DESCRIPTION("Test that stale handle indices (inconsistent state after core validation error) are handled correctly");
     RETURN_IF_SKIP(InitSyncVal());
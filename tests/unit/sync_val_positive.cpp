@@ -52,6 +52,17 @@ void VkSyncValTest::InitSyncValFramework(const SyncValSettings *p_sync_settings)
     settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_shader_accesses_heuristic",
                                             VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &shader_accesses_heuristic});
 
+    const uint32_t retained_memory_limit = sync_settings.retained_memory_limit;
+    settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_retained_memory_limit", VK_LAYER_SETTING_TYPE_UINT32_EXT,
+                                            1, &retained_memory_limit});
+
+    const auto stats = static_cast<VkBool32>(sync_settings.stats);
+    settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_stats", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &stats});
+
+    const uint32_t stats_report_period = sync_settings.stats_report_period;
+    settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_stats_report_period", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                                            &stats_report_period});
+
     VkLayerSettingsCreateInfoEXT settings_create_info = vku::InitStructHelper();
     settings_create_info.settingCount = size32(settings);
     settings_create_info.pSettings = settings.data();
@@ -1304,6 +1315,145 @@ TEST_F(PositiveSyncVal, QSTransitionWithSrcNoneStage2) {
     m_default_queue->Wait();
 }
 
+TEST_F(PositiveSyncVal, RetainedMemoryLimitCollapse) {
+    TEST_DESCRIPTION("Wait on a semaphore whose signaling submission was collapsed by syncval_retained_memory_limit");
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::synchronization2);
+    SyncValSettings settings;
+    settings.submit_time_validation = true;
+    settings.retained_memory_limit = 1;  // MiB
+    RETURN_IF_SKIP(InitSyncVal(&settings));
+
+    // The info message reports the estimated memory before and after the collapse
+    std::string limit_message;
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.callback = [&limit_message](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData,
+                                              DebugUtilsLabelCheckData *) {
+        if (pCallbackData->pMessageIdName &&
+            std::string_view(pCallbackData->pMessageIdName) == "SYNCVAL-RETAINED-MEMORY-LIMIT") {
+            limit_message = pCallbackData->pMessage;
+        }
+    };
+    callback_data.count = 0;
+    VkDebugUtilsMessengerCreateInfoEXT messenger_ci = vku::InitStructHelper();
+    messenger_ci.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+    messenger_ci.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    messenger_ci.pfnUserCallback = DebugUtilsCallback;
+    messenger_ci.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    vk::CreateDebugUtilsMessengerEXT(instance(), &messenger_ci, nullptr, &messenger);
+
+    // Many disjoint regions, so the accesses of the first submission take well over 1 MiB
+    constexpr uint32_t region_count = 16384;
+    constexpr VkDeviceSize buffer_size = region_count * 8;
+    vkt::Buffer src(*m_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer dst(*m_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer readback(*m_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    std::vector<VkBufferCopy> regions(region_count);
+    for (uint32_t i = 0; i < region_count; ++i) {
+        regions[i] = {i * 8u, i * 8u, 4};
+    }
+    vkt::Semaphore semaphore(*m_device);
+
+    vkt::CommandBuffer cb_write(*m_device, m_command_pool);
+    cb_write.Begin();
+    vk::CmdCopyBuffer(cb_write, src, dst, region_count, regions.data());
+    cb_write.End();
+
+    vkt::CommandBuffer cb_empty(*m_device, m_command_pool);
+    cb_empty.Begin();
+    cb_empty.End();
+
+    vkt::CommandBuffer cb_read(*m_device, m_command_pool);
+    cb_read.Begin();
+    cb_read.Copy(dst, readback);
+    cb_read.End();
+
+    m_default_queue->Submit2(cb_write, vkt::Signal(semaphore));
+
+    // The first submission is no longer the last one of the queue, only the semaphore keeps it alive and it gets collapsed
+    m_errorMonitor->SetDesiredInfo("SYNCVAL-RETAINED-MEMORY-LIMIT");
+    m_default_queue->Submit2(cb_empty);
+    m_errorMonitor->VerifyFound();
+    vk::DestroyDebugUtilsMessengerEXT(instance(), messenger, nullptr);
+
+    // The memory of the collapsed submission is actually released, it is not just the access count that went down
+    size_t memory_before = 0;
+    size_t memory_after = 0;
+    const size_t went_from = limit_message.find("went from ");
+    ASSERT_NE(std::string::npos, went_from);
+    ASSERT_EQ(2, sscanf(limit_message.c_str() + went_from, "went from %zu to %zu", &memory_before, &memory_after));
+    ASSERT_GT(memory_before, 1024u * 1024u);
+    ASSERT_LE(memory_after, 1024u * 1024u);
+
+    // The writes also reached the empty submission in submission order, without the semaphore barrier. The wait on the
+    // collapsed submission must still synchronize them.
+    m_default_queue->Submit2(cb_read, vkt::Wait(semaphore));
+    m_default_queue->Wait();
+}
+
+// Value of a counter in the last syncval stats report printed to stdout
+static uint64_t LastReportedStat(const std::string &output, const std::string &name) {
+    const std::string key = "\t" + name + " = ";
+    const size_t pos = output.rfind(key);
+    if (pos == std::string::npos) {
+        return 0;
+    }
+    return std::stoull(output.substr(pos + key.size()));
+}
+
+TEST_F(PositiveSyncVal, ParallelSubmitReplay) {
+    TEST_DESCRIPTION("Independent command buffers of a large batch are checked on the worker pool, overlapping ones are not");
+    SyncValSettings settings;
+    settings.submit_time_validation = true;
+    settings.stats = true;
+    settings.stats_report_period = 1;
+    RETURN_IF_SKIP(InitSyncVal(&settings));
+
+    constexpr VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    // Enough command buffers to reach the parallel replay threshold (8)
+    constexpr uint32_t cb_count = 8;
+    std::vector<vkt::Buffer> src_buffers;
+    std::vector<vkt::Buffer> dst_buffers;
+    std::vector<vkt::CommandBuffer> cbs;
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        src_buffers.emplace_back(*m_device, 256, usage);
+        dst_buffers.emplace_back(*m_device, 256, usage);
+    }
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        cbs.emplace_back(*m_device, m_command_pool);
+        cbs[i].Begin();
+        cbs[i].Copy(src_buffers[i], dst_buffers[i]);
+        cbs[i].End();
+    }
+    // Reads the same buffer as cbs[0], which leaves the batch one independent command buffer short of the threshold
+    vkt::CommandBuffer overlapping_cb(*m_device, m_command_pool);
+    overlapping_cb.Begin();
+    overlapping_cb.Copy(src_buffers[0], dst_buffers[1]);
+    overlapping_cb.End();
+
+    std::vector<VkCommandBuffer> independent_batch;
+    for (const auto &cb : cbs) {
+        independent_batch.emplace_back(cb);
+    }
+    std::vector<VkCommandBuffer> overlapping_batch = independent_batch;
+    overlapping_batch[1] = overlapping_cb;
+
+    // The stats are reported at every submission
+    testing::internal::CaptureStdout();
+    m_default_queue->Submit(independent_batch);
+    std::string output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(uint64_t(cb_count), LastReportedStat(output, "parallel_command_buffers"));
+    m_default_queue->Wait();
+
+    testing::internal::CaptureStdout();
+    m_default_queue->Submit(overlapping_batch);
+    output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(uint64_t(cb_count), LastReportedStat(output, "parallel_command_buffers"));
+    m_default_queue->Wait();
+}
+
 TEST_F(PositiveSyncVal, QSTransitionAndRead) {
     TEST_DESCRIPTION("Transition and read image in different submits synchronized via ALL_COMMANDS semaphore");
     SetTargetApiVersion(VK_API_VERSION_1_3);
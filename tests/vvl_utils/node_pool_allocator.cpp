@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+
+#include "containers/node_pool_allocator.h"
+#include "containers/range_map.h"
+
+using PooledMap = std::map<uint32_t, std::string, std::less<uint32_t>,
+                           vvl::node_pool_allocator<std::pair<const uint32_t, std::string>>>;
+
+static void Fill(PooledMap& map, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        map.emplace(i, std::to_string(i));
+    }
+}
+
+static bool HasValues(const PooledMap& map, uint32_t count) {
+    if (map.size() != count) return false;
+    uint32_t expected = 0;
+    for (const auto& [key, value] : map) {
+        if (key != expected || value != std::to_string(expected)) return false;
+        ++expected;
+    }
+    return true;
+}
+
+TEST(CustomContainer, NodePoolAllocatorReuse) {
+    PooledMap map(PooledMap::allocator_type::WithPool());
+    ASSERT_TRUE(map.get_allocator().HasPool());
+    Fill(map, 1000);
+    ASSERT_TRUE(HasValues(map, 1000));
+
+    // Erase every other node and refill, freed blocks are recycled
+    for (uint32_t i = 0; i < 1000; i += 2) {
+        map.erase(i);
+    }
+    ASSERT_EQ(map.size(), 500u);
+    Fill(map, 1000);
+    ASSERT_TRUE(HasValues(map, 1000));
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    Fill(map, 10);
+    ASSERT_TRUE(HasValues(map, 10));
+}
+
+TEST(CustomContainer, NodePoolAllocatorDefaultHasNoPool) {
+    // Temporary containers don't pay for a pool
+    PooledMap map;
+    ASSERT_FALSE(map.get_allocator().HasPool());
+    Fill(map, 100);
+    ASSERT_TRUE(HasValues(map, 100));
+
+    PooledMap copy(map);
+    ASSERT_FALSE(copy.get_allocator().HasPool());
+    ASSERT_TRUE(copy.get_allocator() == map.get_allocator());
+    ASSERT_TRUE(HasValues(copy, 100));
+}
+
+TEST(CustomContainer, NodePoolAllocatorCopyMove) {
+    PooledMap map(PooledMap::allocator_type::WithPool());
+    Fill(map, 100);
+
+    // A copy gets its own pool and outlives the source
+    PooledMap copy(PooledMap::allocator_type::WithPool());
+    {
+        PooledMap source(map);
+        ASSERT_TRUE(source.get_allocator().HasPool());
+        ASSERT_TRUE(source.get_allocator() != map.get_allocator());
+        copy = source;
+    }
+    ASSERT_TRUE(HasValues(copy, 100));
+
+    // A moved allocator still compares equal to its source
+    auto allocator = map.get_allocator();
+    auto moved_allocator(std::move(allocator));
+    ASSERT_TRUE(moved_allocator == allocator);
+
+    // Moved nodes stay valid, and the moved-from map can be used again
+    PooledMap moved(std::move(map));
+    ASSERT_TRUE(HasValues(moved, 100));
+    map.clear();
+    Fill(map, 5);
+    ASSERT_TRUE(HasValues(map, 5));
+
+    PooledMap assigned;
+    assigned = std::move(moved);
+    ASSERT_TRUE(HasValues(assigned, 100));
+
+    std::swap(assigned, copy);
+    ASSERT_TRUE(HasValues(assigned, 100));
+    ASSERT_TRUE(HasValues(copy, 100));
+}
+
+TEST(CustomContainer, NodePoolAllocatorRangeMapMove) {
+    using Range = vvl::range<uint32_t>;
+    using PooledRangeMap =
+        sparse_container::range_map<uint32_t, uint32_t, Range,
+                                    std::map<Range, uint32_t, std::less<Range>,
+                                             vvl::node_pool_allocator<std::pair<const Range, uint32_t>>>>;
+    PooledRangeMap map(PooledRangeMap::allocator_type::WithPool());
+    for (uint32_t i = 0; i < 100; ++i) {
+        map.insert({Range(i * 2, i * 2 + 1), i});
+    }
+    const auto allocator = map.get_allocator();
+
+    // The moved-from map no longer shares the pool with the map that took its nodes
+    PooledRangeMap moved(std::move(map));
+    ASSERT_TRUE(moved.get_allocator() == allocator);
+    ASSERT_FALSE(map.get_allocator().HasPool());
+    ASSERT_EQ(moved.size(), 100u);
+    map.insert({Range(0, 10), 0});
+    ASSERT_EQ(map.size(), 1u);
+
+    PooledRangeMap assigned(PooledRangeMap::allocator_type::WithPool());
+    assigned = std::move(moved);
+    ASSERT_TRUE(assigned.get_allocator() == allocator);
+    ASSERT_FALSE(moved.get_allocator().HasPool());
+    ASSERT_EQ(assigned.size(), 100u);
+    ASSERT_TRUE(moved.empty());
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <vector>
+
+#include "containers/range_set.h"
+
+using RangeSet = vvl::range_set<uint32_t>;
+using Range = RangeSet::range_type;
+
+static std::vector<Range> Ranges(const RangeSet& set) { return std::vector<Range>(set.begin(), set.end()); }
+
+TEST(CustomContainer, RangeSetCoalesce) {
+    RangeSet set;
+    ASSERT_TRUE(set.empty());
+
+    for (uint32_t i = 0; i < 64; ++i) {
+        set.insert(i);
+    }
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_TRUE(Ranges(set)[0] == Range(0, 64));
+
+    // Adjacent on either side merges into the existing range
+    set.insert(Range(64, 70));
+    set.insert(Range(100, 110));
+    ASSERT_EQ(set.size(), 2u);
+    set.insert(Range(70, 100));
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_TRUE(Ranges(set)[0] == Range(0, 110));
+
+    // Empty ranges are ignored
+    set.insert(Range(200, 200));
+    ASSERT_EQ(set.size(), 1u);
+
+    set.clear();
+    ASSERT_TRUE(set.empty());
+}
+
+TEST(CustomContainer, RangeSetOverlap) {
+    RangeSet set;
+    set.insert(Range(10, 20));
+    set.insert(Range(30, 40));
+    set.insert(Range(50, 60));
+    set.insert(Range(0, 5));
+    ASSERT_EQ(set.size(), 4u);
+
+    // Spans several existing ranges without touching the first one
+    set.insert(Range(15, 55));
+    const std::vector<Range> expected = {Range(0, 5), Range(10, 60)};
+    ASSERT_EQ(Ranges(set).size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_TRUE(Ranges(set)[i] == expected[i]);
+    }
+
+    // Fully contained insert is a no-op
+    set.insert(Range(20, 30));
+    ASSERT_EQ(set.size(), 2u);
+}
+
+TEST(CustomContainer, RangeSetMerge) {
+    RangeSet set;
+    set.insert(Range(0, 5));
+    set.insert(Range(20, 30));
+    set.insert(Range(50, 60));
+
+    RangeSet other;
+    other.insert(Range(5, 10));   // touches the first range
+    other.insert(Range(25, 52));  // bridges two ranges
+    other.insert(Range(70, 80));  // past the end
+    set.insert(other);
+
+    const std::vector<Range> expected = {Range(0, 10), Range(20, 60), Range(70, 80)};
+    ASSERT_EQ(Ranges(set).size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_TRUE(Ranges(set)[i] == expected[i]);
+    }
+
+    RangeSet empty;
+    empty.insert(set);
+    ASSERT_EQ(Ranges(empty).size(), expected.size());
+    set.insert(RangeSet());
+    ASSERT_EQ(set.size(), expected.size());
+}
+
+TEST(CustomContainer, RangeSetContains) {
+    RangeSet set;
+    ASSERT_FALSE(set.contains(0));
+
+    set.insert(Range(4, 8));
+    set.insert(12);
+    ASSERT_FALSE(set.contains(3));
+    ASSERT_TRUE(set.contains(4));
+    ASSERT_TRUE(set.contains(7));
+    ASSERT_FALSE(set.contains(8));
+    ASSERT_FALSE(set.contains(11));
+    ASSERT_TRUE(set.contains(12));
+    ASSERT_FALSE(set.contains(13));
+
+    ASSERT_FALSE(set.intersects(Range(0, 4)));
+    ASSERT_TRUE(set.intersects(Range(0, 5)));
+    ASSERT_TRUE(set.intersects(Range(7, 12)));
+    ASSERT_FALSE(set.intersects(Range(8, 12)));
+    ASSERT_TRUE(set.intersects(Range(12, 13)));
+    ASSERT_FALSE(set.intersects(Range(13, 100)));
+    ASSERT_FALSE(set.intersects(Range(5, 5)));
+}